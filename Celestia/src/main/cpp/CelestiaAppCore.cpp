@@ -8,14 +8,30 @@
 // of the License, or (at your option) any later version.
 
 #include "CelestiaSelection.h"
+#include "CelestiaStartupProfiler.h"
+#include "CelestiaNameCache.h"
+#include "CelestiaSimulation.h"
+#include "CelestiaStarBrowser.h"
+#include "CelestiaNativeMethods.h"
+#include <algorithm>
+#include <array>
+#include <cctype>
+#include <filesystem>
+#include <optional>
 #include <string>
+#include <vector>
 
+#include <dlfcn.h>
 #include <unistd.h>
 
 #include <celestia/celestiacore.h>
 #include <celengine/body.h>
+#include <celengine/dsodb.h>
 #include <celengine/glsupport.h>
 #include <celengine/location.h>
+#include <celengine/simulation.h>
+#include <celengine/stardb.h>
+#include <celengine/universe.h>
 #include <celestia/configfile.h>
 #include <celestia/helper.h>
 #include <celestia/progressnotifier.h>
@@ -74,6 +90,12 @@ jmethodID completionInitMethodID = nullptr;
 jclass timelinePhaseClz = nullptr;
 jmethodID timelinePhaseInitMethodID = nullptr;
 
+jclass cancellationSignalClz = nullptr;
+jmethodID cancellationSignalIsCanceledMethodID = nullptr;
+
+jclass eclipseBatchReceiverClz = nullptr;
+jmethodID eclipseBatchReceiverOnBatchMethodID = nullptr;
+
 pthread_key_t javaEnvKey;
 
 extern "C" {
@@ -135,26 +157,92 @@ jint JNI_OnLoad(JavaVM *vm, void *reserved)
     timelinePhaseClz = static_cast<jclass>(env->NewGlobalRef(env->FindClass("space/celestia/celestia/Timeline$Phase")));
     timelinePhaseInitMethodID = env->GetMethodID(timelinePhaseClz, "<init>", "(DD)V");
 
+    cancellationSignalClz = static_cast<jclass>(env->NewGlobalRef(env->FindClass("android/os/CancellationSignal")));
+    cancellationSignalIsCanceledMethodID = env->GetMethodID(cancellationSignalClz, "isCanceled", "()Z");
+
+    eclipseBatchReceiverClz = static_cast<jclass>(env->NewGlobalRef(env->FindClass("space/celestia/celestia/EclipseFinder$BatchReceiver")));
+    eclipseBatchReceiverOnBatchMethodID = env->GetMethodID(eclipseBatchReceiverClz, "onBatch", "([J[D)Z");
+
+    registerAppCoreNativeMethods(env);
+    registerBodyNativeMethods(env);
+    registerOrbitNativeMethods(env);
+    registerRotationModelNativeMethods(env);
+
     return JNI_VERSION_1_6;
 }
 }
 
+// Star, deep sky and solar system catalogs, and the binary databases named
+// in the configuration (stars.dat, starnames.dat, crossindex .dat files)
+static bool isCatalogFile(const std::filesystem::path &path)
+{
+    auto extension = path.extension().string();
+    std::transform(extension.begin(), extension.end(), extension.begin(), [](unsigned char c) { return static_cast<char>(std::tolower(c)); });
+    return extension == ".ssc" || extension == ".stc" || extension == ".dsc" || extension == ".dat";
+}
+
+// Size of the catalog files under the catalog roots, for determinate load
+// progress. Only stats files, and symlinked directories are not followed so
+// a link loop cannot make the scan recurse forever
+static std::uint64_t catalogBytes(const std::vector<std::filesystem::path> &roots)
+{
+    std::uint64_t total = 0;
+    for (const auto &root : roots)
+    {
+        std::error_code ec;
+        std::filesystem::recursive_directory_iterator iter(root, std::filesystem::directory_options::skip_permission_denied, ec);
+        for (; !ec && iter != std::filesystem::recursive_directory_iterator(); iter.increment(ec))
+        {
+            std::error_code entryError;
+            if (!isCatalogFile(iter->path()) || !iter->is_regular_file(entryError)) continue;
+            auto size = iter->file_size(entryError);
+            if (!entryError)
+                total += size;
+        }
+    }
+    return total;
+}
+
 class AppCoreProgressWatcher: public ProgressNotifier
 {
 public:
-    AppCoreProgressWatcher(JNIEnv *env, jobject object, jmethodID method) :
+    AppCoreProgressWatcher(JNIEnv *env, jobject object, jmethodID method, std::uint64_t totalBytes) :
     ProgressNotifier(),
     env(env),
     object(object),
-    method(method) {};
+    method(method),
+    totalBytes(totalBytes),
+    initialBytesRead(object ? threadBytesRead() : 0) {};
 
     void update(const std::string& status) override
     {
+        // Each status marks the start of loading the next file, the sample
+        // that begins it also ends the previous one
+        std::optional<std::uint64_t> bytesRead;
+        if (auto &profiler = StartupProfiler::shared(); profiler.isRecording())
+        {
+            auto sample = StartupSample::current();
+            profiler.beginPhase(status, sample);
+            bytesRead = sample.bytesRead;
+        }
+
         if (!object) { return; }
 
+        // Bytes read by this thread so far against the size of all catalog
+        // files, -1 if the size is unknown
+        jlong bytesTotal = -1;
+        jlong bytesDone = 0;
+        if (totalBytes > 0)
+        {
+            if (!bytesRead.has_value())
+                bytesRead = threadBytesRead();
+            bytesTotal = static_cast<jlong>(totalBytes);
+            bytesDone = std::min(bytesTotal, static_cast<jlong>(*bytesRead - initialBytesRead));
+        }
+
         const char *c_str = status.c_str();
         jstring str = env->NewStringUTF(c_str);
-        env->CallVoidMethod(object, method, str);
+        env->CallVoidMethod(object, method, str, bytesDone, bytesTotal);
         env->DeleteLocalRef(str);
     }
 
@@ -162,6 +250,8 @@ private:
     JNIEnv *env;
     jobject object;
     jmethodID method;
+    std::uint64_t totalBytes;
+    std::uint64_t initialBytesRead;
 };
 
 class AppCoreContextMenuHandler: public CelestiaCore::ContextMenuHandler
@@ -272,6 +362,7 @@ JNIEXPORT jboolean JNICALL
 Java_space_celestia_celestia_AppCore_c_1startRenderer(JNIEnv *env, jclass clazz,
                                                                  jlong ptr, jboolean srgb_rendering, jint shadow_map_size) {
     auto core = (CelestiaCore *)ptr;
+    StartupPhaseScope phase("Renderer");
 
     if (!core->initRenderer(celestia::engine::TextureResolution::medres, srgb_rendering == JNI_TRUE))
         return JNI_FALSE;
@@ -314,10 +405,9 @@ Java_space_celestia_celestia_AppCore_c_1startSimulation(JNIEnv *env, jclass claz
     if (wc)
     {
         jclass jWcClz = env->GetObjectClass(wc);
-        jWcMethod = env->GetMethodID(jWcClz, "onCelestiaProgress", "(Ljava/lang/String;)V");
+        jWcMethod = env->GetMethodID(jWcClz, "onCelestiaProgress", "(Ljava/lang/String;JJ)V");
     }
 
-    AppCoreProgressWatcher watcher(env, wc, jWcMethod);
     std::vector<std::filesystem::path> extras;
     if (extra_directories != nullptr)
     {
@@ -338,9 +428,36 @@ Java_space_celestia_celestia_AppCore_c_1startSimulation(JNIEnv *env, jclass claz
         env->ReleaseStringUTFChars(config_file_name, c_str);
     }
 
-    if (!core->initSimulation(configFile, extras, &watcher))
+    // Load progress is measured against the files under the data directory
+    // set by c_chdir and the extra directories
+    std::vector<std::filesystem::path> catalogRoots;
+    std::error_code ec;
+    if (auto dataDirectory = std::filesystem::current_path(ec) / "data"; !ec)
+        catalogRoots.push_back(std::move(dataDirectory));
+    catalogRoots.insert(catalogRoots.end(), extras.begin(), extras.end());
+
+    auto &profiler = StartupProfiler::shared();
+    profiler.start();
+    if (profiler.isRecording())
+        profiler.beginPhase("Configuration", StartupSample::current());
+
+    // Cached star lists, names and completions point into the catalogs
+    // being replaced
+    invalidateStarBrowserCache();
+    invalidateNameCache(env);
+    invalidateCompletionCache();
+
+    AppCoreProgressWatcher watcher(env, wc, jWcMethod, wc ? catalogBytes(catalogRoots) : 0);
+    bool success = core->initSimulation(configFile, extras, &watcher);
+    profiler.endPhase();
+    if (!success)
         return JNI_FALSE;
 
+    auto universe = core->getSimulation()->getUniverse();
+    profiler.setObjectCounts(static_cast<std::int64_t>(universe->getStarCatalog()->size()),
+                             static_cast<std::int64_t>(universe->getDSOCatalog()->size()));
+    profiler.simulationStarted();
+
     return JNI_TRUE;
 }
 
@@ -675,6 +792,10 @@ Java_space_celestia_celestia_AppCore_c_1runScript(JNIEnv *env, jclass clazz,
                                                              jlong ptr,
                                                              jstring path) {
     auto core = (CelestiaCore *)ptr;
+    // Scripts can load catalog fragments that replace objects, a freed
+    // object's address may be reused by another one
+    invalidateNameCache(env);
+    invalidateCompletionCache();
     const char *str = env->GetStringUTFChars(path, nullptr);
     core->runScript(str, false);
     env->ReleaseStringUTFChars(path, str);
@@ -686,6 +807,8 @@ Java_space_celestia_celestia_AppCore_c_1runDemo(JNIEnv *env, jclass clazz, jlong
     auto core = reinterpret_cast<CelestiaCore *>(ptr);
     const auto& demoScriptFile = core->getConfig()->paths.demoScriptFile;
     if (!demoScriptFile.empty()) {
+        invalidateNameCache(env);
+        invalidateCompletionCache();
         core->cancelScript();
         core->runScript(demoScriptFile);
     }
@@ -773,6 +896,51 @@ Java_space_celestia_celestia_AppCore_c_1setLocaleDirectoryPath(JNIEnv *env,
     bind_textdomain_codeset("celestia_ui", "UTF-8");
     textdomain("celestia");
     env->ReleaseStringUTFChars(path, str);
+
+    // Localized names have to be looked up again
+    invalidateNameCache(env);
+    invalidateCompletionCache();
+}
+
+// Levels from android.content.ComponentCallbacks2
+constexpr jint TRIM_MEMORY_RUNNING_LOW = 10;
+constexpr jint TRIM_MEMORY_RUNNING_CRITICAL = 15;
+constexpr jint TRIM_MEMORY_BACKGROUND = 40;
+// From bionic malloc.h, available since API 28
+constexpr int MALLOPT_PURGE = -101;
+
+// Returns freed allocator pages to the system. mallopt is only exported
+// from API 26 and only understands M_PURGE from API 28, where older
+// releases reject the parameter
+static void purgeAllocator()
+{
+    using MalloptFunction = int (*)(int, int);
+    // Resolved once, on the first trim that gets this far
+    static const auto mallopt = reinterpret_cast<MalloptFunction>(dlsym(RTLD_DEFAULT, "mallopt"));
+    if (mallopt != nullptr)
+        mallopt(MALLOPT_PURGE, 0);
+}
+
+extern "C"
+JNIEXPORT void JNICALL
+Java_space_celestia_celestia_AppCore_c_1trimMemory(JNIEnv *env, jclass clazz, jint level) {
+    // Only act when memory is short. UI_HIDDEN just means the UI went away,
+    // and the caches are wanted again as soon as the app comes back
+    bool isRunningLow = level == TRIM_MEMORY_RUNNING_LOW || level == TRIM_MEMORY_RUNNING_CRITICAL;
+    bool isBackground = level >= TRIM_MEMORY_BACKGROUND;
+    if (!isRunningLow && !isBackground)
+        return;
+
+    // This frees very little: the name cache holds weak references and the
+    // completion cache one result list. Textures and catalogs, where the
+    // memory actually is, are left alone
+    invalidateNameCache(env);
+    invalidateCompletionCache();
+
+    if (level == TRIM_MEMORY_RUNNING_LOW)
+        return;
+
+    purgeAllocator();
 }
 
 extern "C"
@@ -784,6 +952,9 @@ Java_space_celestia_celestia_AppCore_c_1setUpLocale(JNIEnv *env, jclass clazz) {
 
     isLocaleSet = true;
     CelestiaCore::initLocale();
+    // Localized names have to be looked up again
+    invalidateNameCache(env);
+    invalidateCompletionCache();
 }
 
 extern "C"
@@ -867,39 +1038,42 @@ Java_space_celestia_celestia_AppCore_c_1setShow##flag (JNIEnv *env, jclass clazz
     core->getRenderer()->setRenderFlags(flags); \
 } \
 
-RENDERMETHODS(Stars)
-RENDERMETHODS(Planets)
-RENDERMETHODS(DwarfPlanets)
-RENDERMETHODS(Moons)
-RENDERMETHODS(MinorMoons)
-RENDERMETHODS(Asteroids)
-RENDERMETHODS(Comets)
-RENDERMETHODS(Spacecrafts)
-RENDERMETHODS(Galaxies)
-RENDERMETHODS(Globulars)
-RENDERMETHODS(Nebulae)
-RENDERMETHODS(OpenClusters)
-RENDERMETHODS(Diagrams)
-RENDERMETHODS(Boundaries)
-RENDERMETHODS(CloudMaps)
-RENDERMETHODS(NightMaps)
-RENDERMETHODS(Atmospheres)
-RENDERMETHODS(CometTails)
-RENDERMETHODS(PlanetRings)
-RENDERMETHODS(Markers)
-RENDERMETHODS(Orbits)
-RENDERMETHODS(FadingOrbits)
-RENDERMETHODS(PartialTrajectories)
-RENDERMETHODS(SmoothLines)
-RENDERMETHODS(EclipseShadows)
-RENDERMETHODS(RingShadows)
-RENDERMETHODS(CloudShadows)
-RENDERMETHODS(AutoMag)
-RENDERMETHODS(CelestialSphere)
-RENDERMETHODS(EclipticGrid)
-RENDERMETHODS(HorizonGrid)
-RENDERMETHODS(GalacticGrid)
-RENDERMETHODS(Ecliptic)
+#define RENDER_FLAGS(X) \
+    X(Stars) \
+    X(Planets) \
+    X(DwarfPlanets) \
+    X(Moons) \
+    X(MinorMoons) \
+    X(Asteroids) \
+    X(Comets) \
+    X(Spacecrafts) \
+    X(Galaxies) \
+    X(Globulars) \
+    X(Nebulae) \
+    X(OpenClusters) \
+    X(Diagrams) \
+    X(Boundaries) \
+    X(CloudMaps) \
+    X(NightMaps) \
+    X(Atmospheres) \
+    X(CometTails) \
+    X(PlanetRings) \
+    X(Markers) \
+    X(Orbits) \
+    X(FadingOrbits) \
+    X(PartialTrajectories) \
+    X(SmoothLines) \
+    X(EclipseShadows) \
+    X(RingShadows) \
+    X(CloudShadows) \
+    X(AutoMag) \
+    X(CelestialSphere) \
+    X(EclipticGrid) \
+    X(HorizonGrid) \
+    X(GalacticGrid) \
+    X(Ecliptic)
+
+RENDER_FLAGS(RENDERMETHODS)
 
 #define LABELMETHODS(flag) extern "C" JNIEXPORT jboolean JNICALL \
 Java_space_celestia_celestia_AppCore_c_1getShow##flag##Labels (JNIEnv *env, jclass clazz, jlong pointer) { \
@@ -916,22 +1090,24 @@ Java_space_celestia_celestia_AppCore_c_1setShow##flag##Labels (JNIEnv *env, jcla
     core->getRenderer()->setLabelMode(flags); \
 } \
 
-LABELMETHODS(Star)
-LABELMETHODS(Planet)
-LABELMETHODS(Moon)
-LABELMETHODS(Constellation)
-LABELMETHODS(Galaxy)
-LABELMETHODS(Globular)
-LABELMETHODS(Nebula)
-LABELMETHODS(OpenCluster)
-LABELMETHODS(Asteroid)
-LABELMETHODS(Spacecraft)
-LABELMETHODS(Location)
-LABELMETHODS(Comet)
-LABELMETHODS(DwarfPlanet)
-LABELMETHODS(MinorMoon)
-
-LABELMETHODS(I18nConstellation)
+#define LABEL_FLAGS(X) \
+    X(Star) \
+    X(Planet) \
+    X(Moon) \
+    X(Constellation) \
+    X(Galaxy) \
+    X(Globular) \
+    X(Nebula) \
+    X(OpenCluster) \
+    X(Asteroid) \
+    X(Spacecraft) \
+    X(Location) \
+    X(Comet) \
+    X(DwarfPlanet) \
+    X(MinorMoon) \
+    X(I18nConstellation)
+
+LABEL_FLAGS(LABELMETHODS)
 
 #define ORBITMETHODS(flag) extern "C" JNIEXPORT jboolean JNICALL \
 Java_space_celestia_celestia_AppCore_c_1getShow##flag##Orbits (JNIEnv *env, jclass clazz, jlong pointer) { \
@@ -948,14 +1124,17 @@ Java_space_celestia_celestia_AppCore_c_1setShow##flag##Orbits (JNIEnv *env, jcla
     core->getRenderer()->setOrbitMask(flags); \
 } \
 
-ORBITMETHODS(Planet)
-ORBITMETHODS(Moon)
-ORBITMETHODS(Asteroid)
-ORBITMETHODS(Spacecraft)
-ORBITMETHODS(Comet)
-ORBITMETHODS(Stellar)
-ORBITMETHODS(DwarfPlanet)
-ORBITMETHODS(MinorMoon)
+#define ORBIT_FLAGS(X) \
+    X(Planet) \
+    X(Moon) \
+    X(Asteroid) \
+    X(Spacecraft) \
+    X(Comet) \
+    X(Stellar) \
+    X(DwarfPlanet) \
+    X(MinorMoon)
+
+ORBIT_FLAGS(ORBITMETHODS)
 
 #define FEATUREMETHODS(flag) extern "C" JNIEXPORT jboolean JNICALL \
 Java_space_celestia_celestia_AppCore_c_1getShow##flag##Labels (JNIEnv *env, jclass clazz, jlong pointer) { \
@@ -970,69 +1149,72 @@ Java_space_celestia_celestia_AppCore_c_1setShow##flag##Labels (JNIEnv *env, jcla
     core->getSimulation()->getObserver().setLocationFilter(bit_mask_value_update(value, Location::flag, core->getSimulation()->getObserver().getLocationFilter())); \
 } \
 
-FEATUREMETHODS(City)
-FEATUREMETHODS(Observatory)
-FEATUREMETHODS(LandingSite)
-FEATUREMETHODS(Crater)
-FEATUREMETHODS(Vallis)
-FEATUREMETHODS(Mons)
-FEATUREMETHODS(Planum)
-FEATUREMETHODS(Chasma)
-FEATUREMETHODS(Patera)
-FEATUREMETHODS(Mare)
-FEATUREMETHODS(Rupes)
-FEATUREMETHODS(Tessera)
-FEATUREMETHODS(Regio)
-FEATUREMETHODS(Chaos)
-FEATUREMETHODS(Terra)
-FEATUREMETHODS(Astrum)
-FEATUREMETHODS(Corona)
-FEATUREMETHODS(Dorsum)
-FEATUREMETHODS(Fossa)
-FEATUREMETHODS(Catena)
-FEATUREMETHODS(Mensa)
-FEATUREMETHODS(Rima)
-FEATUREMETHODS(Undae)
-FEATUREMETHODS(Tholus)
-FEATUREMETHODS(Reticulum)
-FEATUREMETHODS(Planitia)
-FEATUREMETHODS(Linea)
-FEATUREMETHODS(Fluctus)
-FEATUREMETHODS(Farrum)
-FEATUREMETHODS(EruptiveCenter)
-FEATUREMETHODS(Insula)
-FEATUREMETHODS(Albedo)
-FEATUREMETHODS(Arcus)
-FEATUREMETHODS(Cavus)
-FEATUREMETHODS(Colles)
-FEATUREMETHODS(Facula)
-FEATUREMETHODS(Flexus)
-FEATUREMETHODS(Flumen)
-FEATUREMETHODS(Fretum)
-FEATUREMETHODS(Labes)
-FEATUREMETHODS(Labyrinthus)
-FEATUREMETHODS(Lacuna)
-FEATUREMETHODS(Lacus)
-FEATUREMETHODS(LargeRinged)
-FEATUREMETHODS(Lobus)
-FEATUREMETHODS(Lingula)
-FEATUREMETHODS(Macula)
-FEATUREMETHODS(Oceanus)
-FEATUREMETHODS(Palus)
-FEATUREMETHODS(Plume)
-FEATUREMETHODS(Promontorium)
-FEATUREMETHODS(Satellite)
-FEATUREMETHODS(Scopulus)
-FEATUREMETHODS(Serpens)
-FEATUREMETHODS(Sinus)
-FEATUREMETHODS(Sulcus)
-FEATUREMETHODS(Vastitas)
-FEATUREMETHODS(Virga)
-FEATUREMETHODS(Saxum)
-FEATUREMETHODS(Collum)
-FEATUREMETHODS(Cosmodrome)
-FEATUREMETHODS(Ring)
-FEATUREMETHODS(Other)
+#define FEATURE_FLAGS(X) \
+    X(City) \
+    X(Observatory) \
+    X(LandingSite) \
+    X(Crater) \
+    X(Vallis) \
+    X(Mons) \
+    X(Planum) \
+    X(Chasma) \
+    X(Patera) \
+    X(Mare) \
+    X(Rupes) \
+    X(Tessera) \
+    X(Regio) \
+    X(Chaos) \
+    X(Terra) \
+    X(Astrum) \
+    X(Corona) \
+    X(Dorsum) \
+    X(Fossa) \
+    X(Catena) \
+    X(Mensa) \
+    X(Rima) \
+    X(Undae) \
+    X(Tholus) \
+    X(Reticulum) \
+    X(Planitia) \
+    X(Linea) \
+    X(Fluctus) \
+    X(Farrum) \
+    X(EruptiveCenter) \
+    X(Insula) \
+    X(Albedo) \
+    X(Arcus) \
+    X(Cavus) \
+    X(Colles) \
+    X(Facula) \
+    X(Flexus) \
+    X(Flumen) \
+    X(Fretum) \
+    X(Labes) \
+    X(Labyrinthus) \
+    X(Lacuna) \
+    X(Lacus) \
+    X(LargeRinged) \
+    X(Lobus) \
+    X(Lingula) \
+    X(Macula) \
+    X(Oceanus) \
+    X(Palus) \
+    X(Plume) \
+    X(Promontorium) \
+    X(Satellite) \
+    X(Scopulus) \
+    X(Serpens) \
+    X(Sinus) \
+    X(Sulcus) \
+    X(Vastitas) \
+    X(Virga) \
+    X(Saxum) \
+    X(Collum) \
+    X(Cosmodrome) \
+    X(Ring) \
+    X(Other)
+
+FEATURE_FLAGS(FEATUREMETHODS)
 
 #define INTERACTIONMETHODS(flag) extern "C" JNIEXPORT jboolean JNICALL \
 Java_space_celestia_celestia_AppCore_c_1getEnable##flag (JNIEnv *env, jclass clazz, jlong pointer) { \
@@ -1049,9 +1231,12 @@ Java_space_celestia_celestia_AppCore_c_1setEnable##flag (JNIEnv *env, jclass cla
     core->setInteractionFlags(flags); \
 } \
 
-INTERACTIONMETHODS(ReverseWheel)
-INTERACTIONMETHODS(RayBasedDragging)
-INTERACTIONMETHODS(FocusZooming)
+#define INTERACTION_FLAGS(X) \
+    X(ReverseWheel) \
+    X(RayBasedDragging) \
+    X(FocusZooming)
+
+INTERACTION_FLAGS(INTERACTIONMETHODS)
 
 #define OBSERVERMETHODS(flag) extern "C" JNIEXPORT jboolean JNICALL \
 Java_space_celestia_celestia_AppCore_c_1getEnable##flag (JNIEnv *env, jclass clazz, jlong pointer) { \
@@ -1068,7 +1253,10 @@ Java_space_celestia_celestia_AppCore_c_1setEnable##flag (JNIEnv *env, jclass cla
     core->setObserverFlags(flags); \
 }                                                                   \
 
-OBSERVERMETHODS(AlignCameraToSurfaceOnLand)
+#define OBSERVER_FLAGS(X) \
+    X(AlignCameraToSurfaceOnLand)
+
+OBSERVER_FLAGS(OBSERVERMETHODS)
 
 extern "C"
 JNIEXPORT void JNICALL
@@ -1309,25 +1497,23 @@ Java_space_celestia_celestia_AppCore_c_1getAmbientLightLevel(JNIEnv *env, jclass
     return core->getRenderer()->getAmbientLightLevel();
 }
 
-extern "C"
-JNIEXPORT void JNICALL
-Java_space_celestia_celestia_AppCore_c_1setFaintestVisible(JNIEnv *env, jclass clazz, jlong pointer, jdouble faintest_visible) {
-    auto core = (CelestiaCore *)pointer;
+// The meaning of faintest visible depends on whether AutoMag is on, so it
+// has to be applied after the render flags when both change together.
+static void setFaintestVisible(CelestiaCore *core, float faintestVisible)
+{
     if (!celestia::util::is_set(core->getRenderer()->getRenderFlags(), RenderFlags::ShowAutoMag))
     {
-        core->setFaintest(static_cast<float>(faintest_visible));
+        core->setFaintest(faintestVisible);
     }
     else
     {
-        core->getRenderer()->setFaintestAM45deg(static_cast<float>(faintest_visible));
+        core->getRenderer()->setFaintestAM45deg(faintestVisible);
         core->setFaintestAutoMag();
     }
 }
 
-extern "C"
-JNIEXPORT jdouble JNICALL
-Java_space_celestia_celestia_AppCore_c_1getFaintestVisible(JNIEnv *env, jclass clazz, jlong pointer) {
-    auto core = (CelestiaCore *)pointer;
+static double getFaintestVisible(CelestiaCore *core)
+{
     if (!celestia::util::is_set(core->getRenderer()->getRenderFlags(), RenderFlags::ShowAutoMag))
     {
         return core->getSimulation()->getFaintestVisible();
@@ -1338,6 +1524,20 @@ Java_space_celestia_celestia_AppCore_c_1getFaintestVisible(JNIEnv *env, jclass c
     }
 }
 
+extern "C"
+JNIEXPORT void JNICALL
+Java_space_celestia_celestia_AppCore_c_1setFaintestVisible(JNIEnv *env, jclass clazz, jlong pointer, jdouble faintest_visible) {
+    auto core = (CelestiaCore *)pointer;
+    setFaintestVisible(core, static_cast<float>(faintest_visible));
+}
+
+extern "C"
+JNIEXPORT jdouble JNICALL
+Java_space_celestia_celestia_AppCore_c_1getFaintestVisible(JNIEnv *env, jclass clazz, jlong pointer) {
+    auto core = (CelestiaCore *)pointer;
+    return getFaintestVisible(core);
+}
+
 extern "C"
 JNIEXPORT void JNICALL
 Java_space_celestia_celestia_AppCore_c_1setGalaxyBrightness(JNIEnv *env, jclass clazz, jlong pointer, jdouble galaxy_brightness) {
@@ -1364,6 +1564,303 @@ Java_space_celestia_celestia_AppCore_c_1getMinimumFeatureSize(JNIEnv *env, jclas
     return core->getRenderer()->getMinimumFeatureSize();
 }
 
+// Packed render settings, lets the settings screen and preference restore
+// read and write all the flags and scalars above in a single JNI call.
+
+enum class PackedFlagGroup
+{
+    Render = 0,
+    Label,
+    Orbit,
+    Location,
+    Interaction,
+    Observer,
+    ToneMapping,
+    Count,
+};
+
+struct PackedFlag
+{
+    const char *key;
+    PackedFlagGroup group;
+    uint64_t bit;
+};
+
+#define PACKED_FLAG(key, group, bit) PackedFlag{ key, PackedFlagGroup::group, static_cast<uint64_t>(bit) },
+#define RENDER_PACKED_FLAG(flag) PACKED_FLAG("Show" #flag, Render, RenderFlags::Show##flag)
+#define LABEL_PACKED_FLAG(flag) PACKED_FLAG("Show" #flag "Labels", Label, RenderLabels::flag##Labels)
+#define ORBIT_PACKED_FLAG(flag) PACKED_FLAG("Show" #flag "Orbits", Orbit, BodyClassification::flag)
+#define FEATURE_PACKED_FLAG(flag) PACKED_FLAG("Show" #flag "Labels", Location, Location::flag)
+#define INTERACTION_PACKED_FLAG(flag) PACKED_FLAG("Enable" #flag, Interaction, CelestiaCore::InteractionFlags::flag)
+#define OBSERVER_PACKED_FLAG(flag) PACKED_FLAG("Enable" #flag, Observer, celestia::engine::ObserverFlags::flag)
+
+static const PackedFlag packedFlags[] = {
+    RENDER_FLAGS(RENDER_PACKED_FLAG)
+    LABEL_FLAGS(LABEL_PACKED_FLAG)
+    ORBIT_FLAGS(ORBIT_PACKED_FLAG)
+    FEATURE_FLAGS(FEATURE_PACKED_FLAG)
+    INTERACTION_FLAGS(INTERACTION_PACKED_FLAG)
+    OBSERVER_FLAGS(OBSERVER_PACKED_FLAG)
+    PACKED_FLAG("ToneMapping", ToneMapping, 1)
+};
+
+struct PackedIntSetting
+{
+    const char *key;
+    jint (*get)(CelestiaCore *);
+    void (*set)(CelestiaCore *, jint);
+};
+
+static const PackedIntSetting packedIntSettings[] = {
+    { "Resolution",
+      [](CelestiaCore *core) -> jint { return static_cast<jint>(core->getRenderer()->getResolution()); },
+      [](CelestiaCore *core, jint value) { core->getRenderer()->setResolution(static_cast<celestia::engine::TextureResolution>(value)); } },
+    { "HudDetail",
+      [](CelestiaCore *core) -> jint { return static_cast<jint>(core->getHudDetail()); },
+      [](CelestiaCore *core, jint value) { core->setHudDetail(value); } },
+    { "MeasurementSystem",
+      [](CelestiaCore *core) -> jint { return static_cast<jint>(core->getMeasurementSystem()); },
+      [](CelestiaCore *core, jint value) { core->setMeasurementSystem(static_cast<celestia::MeasurementSystem>(value)); } },
+    { "TemperatureScale",
+      [](CelestiaCore *core) -> jint { return static_cast<jint>(core->getTemperatureScale()); },
+      [](CelestiaCore *core, jint value) { core->setTemperatureScale(static_cast<celestia::TemperatureScale>(value)); } },
+    { "TimeZone",
+      [](CelestiaCore *core) -> jint { return core->getTimeZoneBias() == 0 ? 1 : 0; },
+      [](CelestiaCore *core, jint value) { core->setTimeZoneBias(0 == value ? 1 : 0); } },
+    { "DateFormat",
+      [](CelestiaCore *core) -> jint { return static_cast<jint>(core->getDateFormat()); },
+      [](CelestiaCore *core, jint value) { core->setDateFormat(static_cast<celestia::astro::Date::Format>(value)); } },
+    { "StarStyle",
+      [](CelestiaCore *core) -> jint { return static_cast<jint>(core->getRenderer()->getStarStyle()); },
+      [](CelestiaCore *core, jint value) { core->getRenderer()->setStarStyle(static_cast<StarStyle>(value)); } },
+    { "StarColors",
+      [](CelestiaCore *core) -> jint { return static_cast<jint>(core->getRenderer()->getStarColorTable()); },
+      [](CelestiaCore *core, jint value) { core->getRenderer()->setStarColorTable(static_cast<ColorTableType>(value)); } },
+};
+
+struct PackedDoubleSetting
+{
+    const char *key;
+    jdouble (*get)(CelestiaCore *);
+    void (*set)(CelestiaCore *, jdouble);
+};
+
+// FaintestVisible stays last, it is applied after the other values and the
+// AutoMag flag it depends on.
+static const PackedDoubleSetting packedDoubleSettings[] = {
+    { "StarPointRadius",
+      [](CelestiaCore *core) -> jdouble { return core->getRenderer()->getStarPointRadius(); },
+      [](CelestiaCore *core, jdouble value) { core->getRenderer()->setStarPointRadius(static_cast<float>(value)); } },
+    { "StarOptimization",
+      [](CelestiaCore *core) -> jdouble { return core->getRenderer()->getStarOptimization(); },
+      [](CelestiaCore *core, jdouble value) { core->getRenderer()->setStarOptimization(static_cast<float>(value)); } },
+    { "StarMaxIrradiance",
+      [](CelestiaCore *core) -> jdouble { return core->getRenderer()->getStarMaxIrradiance(); },
+      [](CelestiaCore *core, jdouble value) { core->getRenderer()->setStarMaxIrradiance(static_cast<float>(value)); } },
+    { "StarExposure",
+      [](CelestiaCore *core) -> jdouble { return core->getRenderer()->getStarExposure(); },
+      [](CelestiaCore *core, jdouble value) { core->getRenderer()->setStarExposure(static_cast<float>(value)); } },
+    { "Exposure",
+      [](CelestiaCore *core) -> jdouble { return core->getRenderer()->getExposure(); },
+      [](CelestiaCore *core, jdouble value) { core->getRenderer()->setExposure(static_cast<float>(value)); } },
+    { "StarDimClipFactor",
+      [](CelestiaCore *core) -> jdouble { return core->getRenderer()->getStarDimClipFactor(); },
+      [](CelestiaCore *core, jdouble value) { core->getRenderer()->setStarDimClipFactor(static_cast<float>(value)); } },
+    { "TintSaturation",
+      [](CelestiaCore *core) -> jdouble { return core->getRenderer()->getTintSaturation(); },
+      [](CelestiaCore *core, jdouble value) { core->getRenderer()->setTintSaturation(static_cast<float>(value)); } },
+    { "AmbientLightLevel",
+      [](CelestiaCore *core) -> jdouble { return core->getRenderer()->getAmbientLightLevel(); },
+      [](CelestiaCore *core, jdouble value) { core->getRenderer()->setAmbientLightLevel(static_cast<float>(value)); } },
+    { "GalaxyBrightness",
+      [](CelestiaCore *) -> jdouble { return Galaxy::getLightGain(); },
+      [](CelestiaCore *, jdouble value) { Galaxy::setLightGain(static_cast<float>(value)); } },
+    { "MinimumFeatureSize",
+      [](CelestiaCore *core) -> jdouble { return core->getRenderer()->getMinimumFeatureSize(); },
+      [](CelestiaCore *core, jdouble value) { core->getRenderer()->setMinimumFeatureSize(static_cast<float>(value)); } },
+    { "FaintestVisible",
+      [](CelestiaCore *core) -> jdouble { return getFaintestVisible(core); },
+      [](CelestiaCore *core, jdouble value) { setFaintestVisible(core, static_cast<float>(value)); } },
+};
+
+constexpr std::size_t PACKED_FLAG_COUNT = std::size(packedFlags);
+constexpr std::size_t PACKED_INT_COUNT = std::size(packedIntSettings);
+constexpr std::size_t PACKED_DOUBLE_COUNT = std::size(packedDoubleSettings);
+
+using PackedFlagMasks = std::array<uint64_t, static_cast<std::size_t>(PackedFlagGroup::Count)>;
+
+static uint64_t &packedFlagMask(PackedFlagMasks &masks, PackedFlagGroup group)
+{
+    return masks[static_cast<std::size_t>(group)];
+}
+
+static PackedFlagMasks readPackedFlagMasks(CelestiaCore *core)
+{
+    auto renderer = core->getRenderer();
+    PackedFlagMasks masks;
+    packedFlagMask(masks, PackedFlagGroup::Render) = static_cast<uint64_t>(renderer->getRenderFlags());
+    packedFlagMask(masks, PackedFlagGroup::Label) = static_cast<uint64_t>(renderer->getLabelMode());
+    packedFlagMask(masks, PackedFlagGroup::Orbit) = static_cast<uint64_t>(renderer->getOrbitMask());
+    packedFlagMask(masks, PackedFlagGroup::Location) = static_cast<uint64_t>(core->getSimulation()->getObserver().getLocationFilter());
+    packedFlagMask(masks, PackedFlagGroup::Interaction) = static_cast<uint64_t>(core->getInteractionFlags());
+    packedFlagMask(masks, PackedFlagGroup::Observer) = static_cast<uint64_t>(core->getObserverFlags());
+    packedFlagMask(masks, PackedFlagGroup::ToneMapping) = renderer->getToneMapping() ? 1 : 0;
+    return masks;
+}
+
+// Only touch the groups that actually changed so unrelated renderer state
+// (and anything observing it) is left alone.
+static void writePackedFlagMasks(CelestiaCore *core, PackedFlagMasks &current, PackedFlagMasks &updated)
+{
+    auto renderer = core->getRenderer();
+    auto changed = [&](PackedFlagGroup group) { return packedFlagMask(current, group) != packedFlagMask(updated, group); };
+
+    if (changed(PackedFlagGroup::Render))
+        renderer->setRenderFlags(static_cast<RenderFlags>(packedFlagMask(updated, PackedFlagGroup::Render)));
+    if (changed(PackedFlagGroup::Label))
+        renderer->setLabelMode(static_cast<RenderLabels>(packedFlagMask(updated, PackedFlagGroup::Label)));
+    if (changed(PackedFlagGroup::Orbit))
+        renderer->setOrbitMask(static_cast<BodyClassification>(packedFlagMask(updated, PackedFlagGroup::Orbit)));
+    if (changed(PackedFlagGroup::Location))
+        core->getSimulation()->getObserver().setLocationFilter(packedFlagMask(updated, PackedFlagGroup::Location));
+    if (changed(PackedFlagGroup::Interaction))
+        core->setInteractionFlags(static_cast<CelestiaCore::InteractionFlags>(packedFlagMask(updated, PackedFlagGroup::Interaction)));
+    if (changed(PackedFlagGroup::Observer))
+        core->setObserverFlags(static_cast<celestia::engine::ObserverFlags>(packedFlagMask(updated, PackedFlagGroup::Observer)));
+    if (changed(PackedFlagGroup::ToneMapping))
+        renderer->setToneMapping(packedFlagMask(updated, PackedFlagGroup::ToneMapping) != 0);
+}
+
+static jobjectArray packedSettingKeys(JNIEnv *env, const char * const *keys, std::size_t count)
+{
+    auto array = env->NewObjectArray(static_cast<jsize>(count), stringClz, nullptr);
+    if (array == nullptr)
+        return nullptr;
+    for (std::size_t i = 0; i < count; ++i)
+    {
+        auto key = env->NewStringUTF(keys[i]);
+        env->SetObjectArrayElement(array, static_cast<jsize>(i), key);
+        env->DeleteLocalRef(key);
+    }
+    return array;
+}
+
+template<typename T, std::size_t N>
+static jobjectArray packedSettingKeys(JNIEnv *env, const T (&settings)[N])
+{
+    std::array<const char *, N> keys;
+    for (std::size_t i = 0; i < N; ++i)
+        keys[i] = settings[i].key;
+    return packedSettingKeys(env, keys.data(), N);
+}
+
+extern "C"
+JNIEXPORT jobjectArray JNICALL
+Java_space_celestia_celestia_RenderSettings_c_1getBooleanKeys(JNIEnv *env, jclass clazz) {
+    return packedSettingKeys(env, packedFlags);
+}
+
+extern "C"
+JNIEXPORT jobjectArray JNICALL
+Java_space_celestia_celestia_RenderSettings_c_1getIntKeys(JNIEnv *env, jclass clazz) {
+    return packedSettingKeys(env, packedIntSettings);
+}
+
+extern "C"
+JNIEXPORT jobjectArray JNICALL
+Java_space_celestia_celestia_RenderSettings_c_1getDoubleKeys(JNIEnv *env, jclass clazz) {
+    return packedSettingKeys(env, packedDoubleSettings);
+}
+
+extern "C"
+JNIEXPORT void JNICALL
+Java_space_celestia_celestia_AppCore_c_1getRenderSettings(JNIEnv *env, jclass clazz, jlong pointer,
+                                                         jbooleanArray booleans, jintArray ints, jdoubleArray doubles) {
+    if (static_cast<std::size_t>(env->GetArrayLength(booleans)) != PACKED_FLAG_COUNT ||
+        static_cast<std::size_t>(env->GetArrayLength(ints)) != PACKED_INT_COUNT ||
+        static_cast<std::size_t>(env->GetArrayLength(doubles)) != PACKED_DOUBLE_COUNT)
+        return;
+
+    auto core = reinterpret_cast<CelestiaCore *>(pointer);
+    auto masks = readPackedFlagMasks(core);
+
+    std::array<jboolean, PACKED_FLAG_COUNT> flagValues;
+    for (std::size_t i = 0; i < PACKED_FLAG_COUNT; ++i)
+        flagValues[i] = (packedFlagMask(masks, packedFlags[i].group) & packedFlags[i].bit) != 0 ? JNI_TRUE : JNI_FALSE;
+
+    std::array<jint, PACKED_INT_COUNT> intValues;
+    for (std::size_t i = 0; i < PACKED_INT_COUNT; ++i)
+        intValues[i] = packedIntSettings[i].get(core);
+
+    std::array<jdouble, PACKED_DOUBLE_COUNT> doubleValues;
+    for (std::size_t i = 0; i < PACKED_DOUBLE_COUNT; ++i)
+        doubleValues[i] = packedDoubleSettings[i].get(core);
+
+    env->SetBooleanArrayRegion(booleans, 0, PACKED_FLAG_COUNT, flagValues.data());
+    env->SetIntArrayRegion(ints, 0, PACKED_INT_COUNT, intValues.data());
+    env->SetDoubleArrayRegion(doubles, 0, PACKED_DOUBLE_COUNT, doubleValues.data());
+}
+
+template<typename T, typename ArrayType, std::size_t N>
+static bool readChangedSettings(JNIEnv *env, ArrayType values, jintArray changed,
+                                void (JNIEnv::*getRegion)(ArrayType, jsize, jsize, T *),
+                                std::array<T, N> &valueBuffer, std::vector<jint> &changedBuffer)
+{
+    if (static_cast<std::size_t>(env->GetArrayLength(values)) != N)
+        return false;
+    changedBuffer.resize(env->GetArrayLength(changed));
+    if (changedBuffer.empty())
+        return true;
+    env->GetIntArrayRegion(changed, 0, static_cast<jsize>(changedBuffer.size()), changedBuffer.data());
+    (env->*getRegion)(values, 0, N, valueBuffer.data());
+    for (auto index : changedBuffer)
+    {
+        if (index < 0 || static_cast<std::size_t>(index) >= N)
+            return false;
+    }
+    return true;
+}
+
+extern "C"
+JNIEXPORT void JNICALL
+Java_space_celestia_celestia_AppCore_c_1applyRenderSettings(JNIEnv *env, jclass clazz, jlong pointer,
+                                                           jbooleanArray booleans, jintArray changed_booleans,
+                                                           jintArray ints, jintArray changed_ints,
+                                                           jdoubleArray doubles, jintArray changed_doubles) {
+    std::array<jboolean, PACKED_FLAG_COUNT> flagValues;
+    std::array<jint, PACKED_INT_COUNT> intValues;
+    std::array<jdouble, PACKED_DOUBLE_COUNT> doubleValues;
+    std::vector<jint> changedFlags;
+    std::vector<jint> changedInts;
+    std::vector<jint> changedDoubles;
+    if (!readChangedSettings(env, booleans, changed_booleans, &JNIEnv::GetBooleanArrayRegion, flagValues, changedFlags) ||
+        !readChangedSettings(env, ints, changed_ints, &JNIEnv::GetIntArrayRegion, intValues, changedInts) ||
+        !readChangedSettings(env, doubles, changed_doubles, &JNIEnv::GetDoubleArrayRegion, doubleValues, changedDoubles))
+        return;
+
+    auto core = reinterpret_cast<CelestiaCore *>(pointer);
+    if (!changedFlags.empty())
+    {
+        auto current = readPackedFlagMasks(core);
+        auto updated = current;
+        for (auto index : changedFlags)
+        {
+            const auto &flag = packedFlags[index];
+            auto &mask = packedFlagMask(updated, flag.group);
+            mask = flagValues[index] ? (mask | flag.bit) : (mask & ~flag.bit);
+        }
+        writePackedFlagMasks(core, current, updated);
+    }
+
+    for (auto index : changedInts)
+        packedIntSettings[index].set(core, intValues[index]);
+
+    // Sorted so FaintestVisible, the last entry, goes after the rest
+    std::sort(changedDoubles.begin(), changedDoubles.end());
+    for (auto index : changedDoubles)
+        packedDoubleSettings[index].set(core, doubleValues[index]);
+}
+
 extern "C"
 JNIEXPORT void JNICALL
 Java_space_celestia_celestia_AppCore_c_1setFont(JNIEnv *env, jclass clazz,
@@ -1372,6 +1869,7 @@ Java_space_celestia_celestia_AppCore_c_1setFont(JNIEnv *env, jclass clazz,
                                                            jint collection_index,
                                                            jint font_size) {
     auto core = (CelestiaCore *)ptr;
+    StartupPhaseScope phase("Fonts");
     const char *c_path = env->GetStringUTFChars(font_path, nullptr);
     core->setHudFont(c_path, collection_index, font_size);
     env->ReleaseStringUTFChars(font_path, c_path);
@@ -1385,6 +1883,7 @@ Java_space_celestia_celestia_AppCore_c_1setTitleFont(JNIEnv *env, jclass clazz,
                                                                 jint collection_index,
                                                                 jint font_size) {
     auto core = (CelestiaCore *)ptr;
+    StartupPhaseScope phase("Fonts");
     const char *c_path = env->GetStringUTFChars(font_path, nullptr);
     core->setHudTitleFont(c_path, collection_index, font_size);
     env->ReleaseStringUTFChars(font_path, c_path);
@@ -1399,6 +1898,7 @@ Java_space_celestia_celestia_AppCore_c_1setRendererFont(JNIEnv *env, jclass claz
                                                                    jint font_size,
                                                                    jint font_style) {
     auto core = (CelestiaCore *)ptr;
+    StartupPhaseScope phase("Fonts");
     const char *c_path = env->GetStringUTFChars(font_path, nullptr);
     core->setRendererFont(c_path, collection_index, font_size, (Renderer::FontStyle)font_style);
     env->ReleaseStringUTFChars(font_path, c_path);
@@ -1509,4 +2009,25 @@ JNIEXPORT jint JNICALL
 Java_space_celestia_celestia_AppCore_c_1getTextEnterMode(JNIEnv *env, jclass clazz, jlong ptr) {
     auto core = reinterpret_cast<CelestiaCore *>(ptr);
     return static_cast<jint>(core->getTextEnterMode());
-}
\ No newline at end of file
+}
+
+#define FLAG_NATIVE_METHODS(prefix, flag, suffix) \
+    CELESTIA_NATIVE_METHOD("c_get" #prefix #flag #suffix, Java_space_celestia_celestia_AppCore_c_1get##prefix##flag##suffix), \
+    CELESTIA_NATIVE_METHOD("c_set" #prefix #flag #suffix, Java_space_celestia_celestia_AppCore_c_1set##prefix##flag##suffix),
+
+#define RENDER_NATIVE_METHODS(flag) FLAG_NATIVE_METHODS(Show, flag, )
+#define LABEL_NATIVE_METHODS(flag) FLAG_NATIVE_METHODS(Show, flag, Labels)
+#define ORBIT_NATIVE_METHODS(flag) FLAG_NATIVE_METHODS(Show, flag, Orbits)
+#define ENABLE_NATIVE_METHODS(flag) FLAG_NATIVE_METHODS(Enable, flag, )
+
+bool registerAppCoreNativeMethods(JNIEnv *env) {
+    static const JNINativeMethod methods[] = {
+        RENDER_FLAGS(RENDER_NATIVE_METHODS)
+        LABEL_FLAGS(LABEL_NATIVE_METHODS)
+        ORBIT_FLAGS(ORBIT_NATIVE_METHODS)
+        FEATURE_FLAGS(LABEL_NATIVE_METHODS)
+        INTERACTION_FLAGS(ENABLE_NATIVE_METHODS)
+        OBSERVER_FLAGS(ENABLE_NATIVE_METHODS)
+    };
+    return celestia::jni::registerNativeMethods(env, "space/celestia/celestia/AppCore", methods, std::size(methods));
+}
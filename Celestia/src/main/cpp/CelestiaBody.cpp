@@ -8,6 +8,8 @@
 // of the License, or (at your option) any later version.
 
 #include "CelestiaJNI.h"
+#include "CelestiaNameCache.h"
+#include "CelestiaNativeMethods.h"
 #include <celengine/body.h>
 #include <celengine/stardb.h>
 #include <celengine/timeline.h>
@@ -24,7 +26,7 @@ extern "C"
 JNIEXPORT jstring JNICALL
 Java_space_celestia_celestia_Body_c_1getName(JNIEnv *env, jclass clazz, jlong pointer) {
     auto body = reinterpret_cast<Body *>(pointer);
-    return env->NewStringUTF(body->getName(true).c_str());
+    return cachedName(env, body, CachedNameKind::Body, [body] { return body->getName(true); });
 }
 
 extern "C"
@@ -136,4 +138,24 @@ Java_space_celestia_celestia_Body_c_1getPath(JNIEnv *env, jclass clazz, jlong po
     auto body = reinterpret_cast<Body *>(pointer);
     auto starCatalog = reinterpret_cast<StarDatabase *>(star_catalog_pointer);
     return env->NewStringUTF(body->getPath(starCatalog).c_str());
-}
\ No newline at end of file
+}
+
+bool registerBodyNativeMethods(JNIEnv *env) {
+    static const JNINativeMethod bodyMethods[] = {
+        CELESTIA_NATIVE_METHOD("c_getType", Java_space_celestia_celestia_Body_c_1getType),
+        CELESTIA_NATIVE_METHOD("c_hasRings", Java_space_celestia_celestia_Body_c_1hasRings),
+        CELESTIA_NATIVE_METHOD("c_hasAtmosphere", Java_space_celestia_celestia_Body_c_1hasAtmosphere),
+        CELESTIA_NATIVE_METHOD("c_isEllipsoid", Java_space_celestia_celestia_Body_c_1isEllipsoid),
+        CELESTIA_NATIVE_METHOD("c_getRadius", Java_space_celestia_celestia_Body_c_1getRadius),
+        CELESTIA_NATIVE_METHOD("c_getOrbitAtTime", Java_space_celestia_celestia_Body_c_1getOrbitAtTime),
+        CELESTIA_NATIVE_METHOD("c_getRotationModelAtTime", Java_space_celestia_celestia_Body_c_1getRotationModelAtTime),
+        CELESTIA_NATIVE_METHOD("c_getPlanetarySystem", Java_space_celestia_celestia_Body_c_1getPlanetarySystem),
+        CELESTIA_NATIVE_METHOD("c_getTimeline", Java_space_celestia_celestia_Body_c_1getTimeline),
+        CELESTIA_NATIVE_METHOD("c_canBeUsedAsCockpit", Java_space_celestia_celestia_Body_c_1canBeUsedAsCockpit),
+    };
+    static const JNINativeMethod timelineMethods[] = {
+        CELESTIA_NATIVE_METHOD("c_getPhaseCount", Java_space_celestia_celestia_Timeline_c_1getPhaseCount),
+    };
+    bool registered = celestia::jni::registerNativeMethods(env, "space/celestia/celestia/Body", bodyMethods, std::size(bodyMethods));
+    return celestia::jni::registerNativeMethods(env, "space/celestia/celestia/Timeline", timelineMethods, std::size(timelineMethods)) && registered;
+}
@@ -8,6 +8,7 @@
 // of the License, or (at your option) any later version.
 
 #include "CelestiaJNI.h"
+#include "CelestiaNameCache.h"
 #include <celengine/dsodb.h>
 
 extern "C"
@@ -15,7 +16,9 @@ JNIEXPORT jstring JNICALL
 Java_space_celestia_celestia_DSOCatalog_c_1getDSOName(JNIEnv *env, jclass clazz, jlong ptr, jlong pointer,
                                                       jboolean localized) {
     auto d = reinterpret_cast<DSODatabase *>(ptr);
-    return env->NewStringUTF(d->getDSOName(reinterpret_cast<DeepSkyObject *>(pointer), localized == JNI_TRUE).c_str());
+    auto dso = reinterpret_cast<DeepSkyObject *>(pointer);
+    bool isLocalized = localized == JNI_TRUE;
+    return cachedName(env, dso, isLocalized ? CachedNameKind::LocalizedDSO : CachedNameKind::DSO, [d, dso, isLocalized] { return d->getDSOName(dso, isLocalized); });
 }
 
 extern "C"
@@ -8,7 +8,8 @@
 // of the License, or (at your option) any later version.
 
 #include "CelestiaJNI.h"
-#include <json.hpp>
+#include <atomic>
+#include <vector>
 #include <celestia/eclipsefinder.h>
 
 class EclipseSeacherWatcher: public EclipseFinderWatcher
@@ -20,6 +21,9 @@ public:
 
     Status eclipseFinderProgressUpdate(double t) override
     {
+        // The finder appends to the results as it goes, flush whatever is new
+        if (!aborted && results.size() > reportedCount)
+            flushResults();
         return aborted ? Status::AbortOperation : Status::ContinueOperation;
     };
 
@@ -28,11 +32,62 @@ public:
         delete finder;
     }
 
-    EclipseFinder *getFinder() { return finder; }
+    void search(JNIEnv *env, jobject receiver, int kind, double startTime, double endTime)
+    {
+        this->env = env;
+        this->receiver = receiver;
+        results.clear();
+        reportedCount = 0;
+
+        finder->findEclipses(startTime, endTime, static_cast<Eclipse::Type>(kind), results);
+        if (!aborted && results.size() > reportedCount)
+            flushResults();
+
+        this->env = nullptr;
+        this->receiver = nullptr;
+        results.clear();
+    }
+
     void abort() { aborted = true; }
 private:
-    bool aborted;
+    void flushResults()
+    {
+        // Each eclipse is packed as (occulter, receiver) and (startTime, endTime)
+        auto count = static_cast<jsize>(results.size() - reportedCount);
+        std::vector<jlong> bodies;
+        std::vector<jdouble> times;
+        bodies.reserve(count * 2);
+        times.reserve(count * 2);
+        for (auto i = reportedCount; i < results.size(); i++)
+        {
+            const auto& result = results[i];
+            bodies.push_back(reinterpret_cast<jlong>(result.occulter));
+            bodies.push_back(reinterpret_cast<jlong>(result.receiver));
+            times.push_back(result.startTime);
+            times.push_back(result.endTime);
+        }
+        reportedCount = results.size();
+
+        jlongArray jBodies = env->NewLongArray(count * 2);
+        env->SetLongArrayRegion(jBodies, 0, count * 2, bodies.data());
+        jdoubleArray jTimes = env->NewDoubleArray(count * 2);
+        env->SetDoubleArrayRegion(jTimes, 0, count * 2, times.data());
+        jboolean shouldContinue = env->CallBooleanMethod(receiver, eclipseBatchReceiverOnBatchMethodID, jBodies, jTimes);
+        env->DeleteLocalRef(jBodies);
+        env->DeleteLocalRef(jTimes);
+        // Leave a pending exception for the caller of c_search to rethrow,
+        // no more JNI calls may be made until then
+        if (env->ExceptionCheck() || shouldContinue != JNI_TRUE)
+            aborted = true;
+    }
+
+    std::atomic<bool> aborted;
     EclipseFinder *finder;
+
+    JNIEnv *env{ nullptr };
+    jobject receiver{ nullptr };
+    std::vector<Eclipse> results;
+    std::size_t reportedCount{ 0 };
 };
 
 extern "C"
@@ -59,25 +114,12 @@ Java_space_celestia_celestia_EclipseFinder_c_1abort(JNIEnv *env, jclass clazz,
 }
 
 extern "C"
-JNIEXPORT jstring JNICALL
+JNIEXPORT void JNICALL
 Java_space_celestia_celestia_EclipseFinder_c_1search(JNIEnv *env, jclass clazz,
                                                                 jlong ptr, jint kind,
                                                                 jdouble start_time_julian,
-                                                                jdouble end_time_julian) {
-    EclipseFinder *finder = reinterpret_cast<EclipseSeacherWatcher*>(ptr)->getFinder();
-    std::vector<Eclipse> results;
-    finder->findEclipses(start_time_julian, end_time_julian, static_cast<Eclipse::Type>(kind), results);
-
-    using json = nlohmann::json;
-    json j = json::array();
-    for (const auto& result : results)
-    {
-        json eclipse;
-        eclipse["occulter"] = reinterpret_cast<jlong>(result.occulter);
-        eclipse["receiver"] = reinterpret_cast<jlong>(result.receiver);
-        eclipse["startTime"] = result.startTime;
-        eclipse["endTime"] = result.endTime;
-        j.push_back(eclipse);
-    }
-    return env->NewStringUTF(j.dump(-1, ' ', false, nlohmann::detail::error_handler_t::replace).c_str());
-}
\ No newline at end of file
+                                                                jdouble end_time_julian,
+                                                                jobject receiver) {
+    auto watcher = reinterpret_cast<EclipseSeacherWatcher*>(ptr);
+    watcher->search(env, receiver, kind, start_time_julian, end_time_julian);
+}
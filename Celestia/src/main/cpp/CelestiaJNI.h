@@ -61,6 +61,14 @@ extern jmethodID completionInitMethodID;
 extern jclass timelinePhaseClz;
 extern jmethodID timelinePhaseInitMethodID;
 
+// cancellation signal
+extern jclass cancellationSignalClz;
+extern jmethodID cancellationSignalIsCanceledMethodID;
+
+// eclipse finder
+extern jclass eclipseBatchReceiverClz;
+extern jmethodID eclipseBatchReceiverOnBatchMethodID;
+
 extern pthread_key_t javaEnvKey;
 }
 
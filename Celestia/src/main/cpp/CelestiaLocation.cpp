@@ -8,11 +8,12 @@
 // of the License, or (at your option) any later version.
 
 #include "CelestiaJNI.h"
+#include "CelestiaNameCache.h"
 #include <celengine/location.h>
 
 extern "C"
 JNIEXPORT jstring JNICALL
 Java_space_celestia_celestia_Location_c_1getName(JNIEnv *env, jclass clazz, jlong pointer) {
     auto location = (Location *)pointer;
-    return env->NewStringUTF(location->getName(true).c_str());
+    return cachedName(env, location, CachedNameKind::Location, [location] { return location->getName(true); });
 }
\ No newline at end of file
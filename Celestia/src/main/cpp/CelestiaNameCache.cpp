@@ -0,0 +1,119 @@
+// CelestiaNameCache.cpp
+//
+// Copyright (C) 2025, Celestia Development Team
+//
+// This program is free software; you can redistribute it and/or
+// modify it under the terms of the GNU General Public License
+// as published by the Free Software Foundation; either version 2
+// of the License, or (at your option) any later version.
+
+#include "CelestiaNameCache.h"
+#include <iterator>
+#include <list>
+#include <mutex>
+#include <unordered_map>
+
+namespace
+{
+
+// Weak global references share a limited table with the rest of the app
+constexpr std::size_t MAX_CACHED_NAMES = 4096;
+
+struct NameKey
+{
+    const void *object;
+    CachedNameKind kind;
+
+    bool operator==(const NameKey &other) const { return object == other.object && kind == other.kind; }
+};
+
+struct NameKeyHash
+{
+    std::size_t operator()(const NameKey &key) const
+    {
+        return std::hash<const void *>()(key.object) ^ (static_cast<std::size_t>(key.kind) << 1);
+    }
+};
+
+struct CachedName
+{
+    jweak ref;
+    std::list<NameKey>::iterator recent;
+};
+
+std::mutex nameCacheMutex;
+std::unordered_map<NameKey, CachedName, NameKeyHash> nameCache;
+// Most recently used first
+std::list<NameKey> recentNames;
+
+void eraseCachedName(JNIEnv *env, std::unordered_map<NameKey, CachedName, NameKeyHash>::iterator it)
+{
+    env->DeleteWeakGlobalRef(it->second.ref);
+    recentNames.erase(it->second.recent);
+    nameCache.erase(it);
+}
+
+// Makes room for one more entry. Strings that have already been collected
+// go first, then the least recently used names, so a full cache does not
+// turn into misses for everything on screen
+void trimNameCache(JNIEnv *env)
+{
+    for (auto it = nameCache.begin(); it != nameCache.end();)
+    {
+        auto next = std::next(it);
+        if (env->IsSameObject(it->second.ref, nullptr))
+            eraseCachedName(env, it);
+        it = next;
+    }
+
+    while (nameCache.size() >= MAX_CACHED_NAMES)
+        eraseCachedName(env, nameCache.find(recentNames.back()));
+}
+
+void clearNameCache(JNIEnv *env)
+{
+    for (const auto &[_, cached] : nameCache)
+        env->DeleteWeakGlobalRef(cached.ref);
+    nameCache.clear();
+    recentNames.clear();
+}
+
+}
+
+jstring lookupCachedName(JNIEnv *env, const void *object, CachedNameKind kind)
+{
+    std::scoped_lock lock(nameCacheMutex);
+    auto it = nameCache.find({ object, kind });
+    if (it == nameCache.end())
+        return nullptr;
+
+    // Returns null when the string has been collected
+    auto name = static_cast<jstring>(env->NewLocalRef(it->second.ref));
+    if (name == nullptr)
+        eraseCachedName(env, it);
+    else
+        recentNames.splice(recentNames.begin(), recentNames, it->second.recent);
+    return name;
+}
+
+void storeCachedName(JNIEnv *env, const void *object, CachedNameKind kind, jstring name)
+{
+    if (name == nullptr)
+        return;
+
+    std::scoped_lock lock(nameCacheMutex);
+    NameKey key{ object, kind };
+    if (auto it = nameCache.find(key); it != nameCache.end())
+        eraseCachedName(env, it);
+    else if (nameCache.size() >= MAX_CACHED_NAMES)
+        trimNameCache(env);
+
+    recentNames.push_front(key);
+    nameCache.try_emplace(key, CachedName{ env->NewWeakGlobalRef(name), recentNames.begin() });
+}
+
+void invalidateNameCache(JNIEnv *env)
+{
+    std::scoped_lock lock(nameCacheMutex);
+    clearNameCache(env);
+}
@@ -0,0 +1,46 @@
+// CelestiaNameCache.h
+//
+// Copyright (C) 2025, Celestia Development Team
+//
+// This program is free software; you can redistribute it and/or
+// modify it under the terms of the GNU General Public License
+// as published by the Free Software Foundation; either version 2
+// of the License, or (at your option) any later version.
+
+#pragma once
+
+#include "CelestiaJNI.h"
+#include <string>
+
+enum class CachedNameKind
+{
+    Body,
+    Location,
+    Star,
+    LocalizedStar,
+    DSO,
+    LocalizedDSO,
+};
+
+jstring lookupCachedName(JNIEnv *env, const void *object, CachedNameKind kind);
+void storeCachedName(JNIEnv *env, const void *object, CachedNameKind kind, jstring name);
+void invalidateNameCache(JNIEnv *env);
+
+// Names are requested again on every bind in list screens, keep the Java
+// strings around as weak global references so that unchanged names skip the
+// lookup and the UTF-8 to UTF-16 conversion. Entries are keyed by object
+// address only, not by locale, so the cache is cleared when the locale
+// changes and whenever objects may be freed: catalogs reloaded or a script
+// started. Once full, the least recently used names are dropped.
+template<typename F>
+jstring cachedName(JNIEnv *env, const void *object, CachedNameKind kind, F &&getName)
+{
+    jstring name = lookupCachedName(env, object, kind);
+    if (name != nullptr)
+        return name;
+
+    std::string value = getName();
+    name = env->NewStringUTF(value.c_str());
+    storeCachedName(env, object, kind, name);
+    return name;
+}
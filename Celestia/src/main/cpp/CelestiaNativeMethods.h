@@ -0,0 +1,69 @@
+// CelestiaNativeMethods.h
+//
+// Copyright (C) 2025, Celestia Development Team
+//
+// This program is free software; you can redistribute it and/or
+// modify it under the terms of the GNU General Public License
+// as published by the Free Software Foundation; either version 2
+// of the License, or (at your option) any later version.
+
+#pragma once
+
+#include <jni.h>
+#include <cstddef>
+#include <iterator>
+
+namespace celestia::jni
+{
+
+template<typename T> struct TypeSignature;
+template<> struct TypeSignature<void>       { static constexpr char value = 'V'; };
+template<> struct TypeSignature<jboolean>   { static constexpr char value = 'Z'; };
+template<> struct TypeSignature<jbyte>      { static constexpr char value = 'B'; };
+template<> struct TypeSignature<jchar>      { static constexpr char value = 'C'; };
+template<> struct TypeSignature<jshort>     { static constexpr char value = 'S'; };
+template<> struct TypeSignature<jint>       { static constexpr char value = 'I'; };
+template<> struct TypeSignature<jlong>      { static constexpr char value = 'J'; };
+template<> struct TypeSignature<jfloat>     { static constexpr char value = 'F'; };
+template<> struct TypeSignature<jdouble>    { static constexpr char value = 'D'; };
+
+// JNI signature of a native function that only takes and returns primitives,
+// e.g. "(JZ)V", computed at compile time from the function type so that it
+// can not get out of sync with the implementation.
+template<typename F> struct MethodSignature;
+
+template<typename R, typename... Args>
+struct MethodSignature<R (*)(JNIEnv *, jclass, Args...)>
+{
+    static constexpr char value[] = { '(', TypeSignature<Args>::value..., ')', TypeSignature<R>::value, '\0' };
+};
+
+// Registration failures are not fatal, the exported Java_* symbols are
+// still found through the default name lookup.
+inline bool registerNativeMethods(JNIEnv *env, const char *className, const JNINativeMethod *methods, std::size_t count)
+{
+    jclass clazz = env->FindClass(className);
+    if (clazz == nullptr)
+    {
+        env->ExceptionClear();
+        return false;
+    }
+
+    bool registered = env->RegisterNatives(clazz, methods, static_cast<jint>(count)) == JNI_OK;
+    if (!registered)
+        env->ExceptionClear();
+    env->DeleteLocalRef(clazz);
+    return registered;
+}
+
+}
+
+#define CELESTIA_NATIVE_METHOD(name, function) \
+    JNINativeMethod{ name, celestia::jni::MethodSignature<decltype(&function)>::value, reinterpret_cast<void *>(&function) }
+
+// Primitive only methods registered from JNI_OnLoad, these are the ones
+// marked @FastNative on the Java side
+bool registerAppCoreNativeMethods(JNIEnv *env);
+bool registerBodyNativeMethods(JNIEnv *env);
+bool registerOrbitNativeMethods(JNIEnv *env);
+bool registerRotationModelNativeMethods(JNIEnv *env);
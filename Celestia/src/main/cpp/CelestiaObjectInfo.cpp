@@ -0,0 +1,194 @@
+// CelestiaObjectInfo.cpp
+//
+// Copyright (C) 2025, Celestia Development Team
+//
+// This program is free software; you can redistribute it and/or
+// modify it under the terms of the GNU General Public License
+// as published by the Free Software Foundation; either version 2
+// of the License, or (at your option) any later version.
+
+#include "CelestiaJNI.h"
+#include "CelestiaNameCache.h"
+
+#include <algorithm>
+#include <vector>
+
+#include <celengine/body.h>
+#include <celengine/deepskyobj.h>
+#include <celengine/dsodb.h>
+#include <celengine/location.h>
+#include <celengine/selection.h>
+#include <celengine/star.h>
+#include <celengine/stardb.h>
+#include <celengine/timeline.h>
+#include <celengine/timelinephase.h>
+#include <celengine/universe.h>
+#include <celephem/orbit.h>
+#include <celephem/rotation.h>
+
+// Record layout, must match ObjectInfo.java
+constexpr jsize OBJECT_INFO_INT_COUNT = 2;
+constexpr jsize OBJECT_INFO_DOUBLE_COUNT = 8;
+constexpr jsize OBJECT_INFO_STRING_COUNT = 2;
+
+namespace
+{
+
+enum ObjectInfoFlags : jint
+{
+    HasRings            = 1 << 0,
+    HasAtmosphere       = 1 << 1,
+    Ellipsoid           = 1 << 2,
+    PeriodicOrbit       = 1 << 3,
+    PeriodicRotation    = 1 << 4,
+    HasTimeline         = 1 << 5,
+};
+
+struct ObjectInfoRecord
+{
+    jint ints[OBJECT_INFO_INT_COUNT]{};
+    jdouble doubles[OBJECT_INFO_DOUBLE_COUNT]{};
+    jstring name{ nullptr };
+    jstring detail{ nullptr };
+
+    jint &flags() { return ints[0]; }
+    jint &subtype() { return ints[1]; }
+    jdouble &radius() { return doubles[0]; }
+    jdouble &orbitalPeriod() { return doubles[1]; }
+    jdouble &rotationPeriod() { return doubles[2]; }
+    jdouble &startTime() { return doubles[3]; }
+    jdouble &endTime() { return doubles[4]; }
+
+    void setPosition(double x, double y, double z)
+    {
+        doubles[5] = x;
+        doubles[6] = y;
+        doubles[7] = z;
+    }
+};
+
+void fillBodyInfo(JNIEnv *env, Body *body, double julianDay, ObjectInfoRecord &record)
+{
+    auto featuresManager = GetBodyFeaturesManager();
+    jint flags = 0;
+    if (featuresManager->getRings(body))
+        flags |= HasRings;
+    if (featuresManager->getAtmosphere(body))
+        flags |= HasAtmosphere;
+    if (body->isEllipsoid())
+        flags |= Ellipsoid;
+
+    if (auto orbit = body->getOrbit(julianDay); orbit != nullptr && orbit->isPeriodic())
+    {
+        flags |= PeriodicOrbit;
+        record.orbitalPeriod() = orbit->getPeriod();
+    }
+    if (auto rotation = body->getRotationModel(julianDay); rotation != nullptr && rotation->isPeriodic())
+    {
+        flags |= PeriodicRotation;
+        record.rotationPeriod() = rotation->getPeriod();
+    }
+    if (auto timeline = body->getTimeline(); timeline != nullptr && timeline->phaseCount() > 0)
+    {
+        flags |= HasTimeline;
+        record.startTime() = timeline->getPhase(0).startTime();
+        record.endTime() = timeline->getPhase(timeline->phaseCount() - 1).endTime();
+    }
+
+    record.flags() = flags;
+    record.subtype() = static_cast<jint>(body->getClassification());
+    record.radius() = body->getRadius();
+    record.name = cachedName(env, body, CachedNameKind::Body, [body] { return body->getName(true); });
+}
+
+void fillStarInfo(JNIEnv *env, const StarDatabase *stardb, Star *star, double julianDay, ObjectInfoRecord &record)
+{
+    record.radius() = star->getRadius();
+    Eigen::Vector3d position = star->getPosition(julianDay).offsetFromKm(UniversalCoord::Zero());
+    record.setPosition(position.x(), position.y(), position.z());
+    record.name = cachedName(env, star, CachedNameKind::LocalizedStar, [stardb, star] { return stardb->getStarName(*star, true); });
+    record.detail = env->NewStringUTF(star->getSpectralType());
+}
+
+void fillDSOInfo(JNIEnv *env, const DSODatabase *dsodb, DeepSkyObject *dso, ObjectInfoRecord &record)
+{
+    record.subtype() = static_cast<jint>(dso->getObjType());
+    record.radius() = dso->getRadius();
+    const Eigen::Vector3d &position = dso->getPosition();
+    record.setPosition(position.x(), position.y(), position.z());
+    record.name = cachedName(env, dso, CachedNameKind::LocalizedDSO, [dsodb, dso] { return dsodb->getDSOName(dso, true); });
+    record.detail = env->NewStringUTF(dso->getDescription().c_str());
+}
+
+void fillLocationInfo(JNIEnv *env, Location *location, ObjectInfoRecord &record)
+{
+    record.radius() = location->getSize();
+    Eigen::Vector3f position = location->getPosition();
+    record.setPosition(position.x(), position.y(), position.z());
+    record.name = cachedName(env, location, CachedNameKind::Location, [location] { return location->getName(true); });
+}
+
+void fillObjectInfo(JNIEnv *env, const Universe *universe, jlong pointer, SelectionType type, double julianDay, ObjectInfoRecord &record)
+{
+    if (pointer == 0)
+        return;
+
+    switch (type)
+    {
+        case SelectionType::Body:
+            fillBodyInfo(env, reinterpret_cast<Body *>(pointer), julianDay, record);
+            break;
+        case SelectionType::Star:
+            fillStarInfo(env, universe->getStarCatalog(), reinterpret_cast<Star *>(pointer), julianDay, record);
+            break;
+        case SelectionType::DeepSky:
+            fillDSOInfo(env, universe->getDSOCatalog(), reinterpret_cast<DeepSkyObject *>(pointer), record);
+            break;
+        case SelectionType::Location:
+            fillLocationInfo(env, reinterpret_cast<Location *>(pointer), record);
+            break;
+        case SelectionType::None:
+        default:
+            break;
+    }
+}
+
+}
+
+extern "C"
+JNIEXPORT void JNICALL
+Java_space_celestia_celestia_Universe_c_1getObjectInfo(JNIEnv *env, jclass clazz, jlong pointer,
+                                                       jlongArray object_pointers, jintArray object_types,
+                                                       jdouble julian_day,
+                                                       jintArray ints, jdoubleArray doubles, jobjectArray strings) {
+    auto universe = reinterpret_cast<const Universe *>(pointer);
+    jsize count = env->GetArrayLength(object_pointers);
+    if (count == 0)
+        return;
+
+    std::vector<jlong> objects(count);
+    std::vector<jint> types(count);
+    env->GetLongArrayRegion(object_pointers, 0, count, objects.data());
+    env->GetIntArrayRegion(object_types, 0, count, types.data());
+
+    std::vector<jint> intValues(count * OBJECT_INFO_INT_COUNT);
+    std::vector<jdouble> doubleValues(count * OBJECT_INFO_DOUBLE_COUNT);
+    for (jsize i = 0; i < count; ++i)
+    {
+        ObjectInfoRecord record;
+        fillObjectInfo(env, universe, objects[i], static_cast<SelectionType>(types[i]), julian_day, record);
+
+        std::copy(std::begin(record.ints), std::end(record.ints), intValues.begin() + i * OBJECT_INFO_INT_COUNT);
+        std::copy(std::begin(record.doubles), std::end(record.doubles), doubleValues.begin() + i * OBJECT_INFO_DOUBLE_COUNT);
+        env->SetObjectArrayElement(strings, i * OBJECT_INFO_STRING_COUNT, record.name);
+        env->SetObjectArrayElement(strings, i * OBJECT_INFO_STRING_COUNT + 1, record.detail);
+        // Keep the local reference table small for long lists
+        if (record.name != nullptr)
+            env->DeleteLocalRef(record.name);
+        if (record.detail != nullptr)
+            env->DeleteLocalRef(record.detail);
+    }
+
+    env->SetIntArrayRegion(ints, 0, count * OBJECT_INFO_INT_COUNT, intValues.data());
+    env->SetDoubleArrayRegion(doubles, 0, count * OBJECT_INFO_DOUBLE_COUNT, doubleValues.data());
+}
@@ -0,0 +1,119 @@
+// CelestiaObserverState.cpp
+//
+// Copyright (C) 2025, Celestia Development Team
+//
+// This program is free software; you can redistribute it and/or
+// modify it under the terms of the GNU General Public License
+// as published by the Free Software Foundation; either version 2
+// of the License, or (at your option) any later version.
+
+#include "CelestiaObserverState.h"
+#include "CelestiaSelection.h"
+
+#include <cstddef>
+#include <cstring>
+#include <thread>
+
+#include <celestia/celestiacore.h>
+#include <celengine/deepskyobj.h>
+#include <celengine/observer.h>
+#include <celengine/simulation.h>
+
+// Offsets used by ObserverState.java
+static_assert(offsetof(ObserverStateBlock, sequence) == 0);
+static_assert(offsetof(ObserverStateBlock, published) == 4);
+static_assert(offsetof(ObserverStateBlock, position) == 8);
+static_assert(offsetof(ObserverStateBlock, orientation) == 56);
+static_assert(offsetof(ObserverStateBlock, time) == 88);
+static_assert(offsetof(ObserverStateBlock, timeScale) == 96);
+static_assert(offsetof(ObserverStateBlock, selectionPointer) == 104);
+static_assert(offsetof(ObserverStateBlock, selectionType) == 112);
+static_assert(offsetof(ObserverStateBlock, selectionIsGalaxy) == 116);
+static_assert(offsetof(ObserverStateBlock, fov) == 120);
+static_assert(offsetof(ObserverStateBlock, frame) == 128);
+static_assert(sizeof(ObserverStateBlock) == 136);
+static_assert(sizeof(std::atomic<uint32_t>) == sizeof(uint32_t) && std::atomic<uint32_t>::is_always_lock_free);
+
+namespace
+{
+// A write takes well under a microsecond, only a stalled render thread
+// keeps the sequence odd this long
+constexpr int maxCopyAttempts = 64;
+}
+
+void ObserverStateFeed::enable()
+{
+    enabled.store(true, std::memory_order_relaxed);
+}
+
+void ObserverStateFeed::publish(CelestiaCore *core)
+{
+    if (!enabled.load(std::memory_order_relaxed))
+        return;
+
+    auto sim = core->getSimulation();
+    const auto &observer = sim->getObserver();
+    auto selection = sim->getSelection();
+    auto orientation = observer.getOrientation();
+
+    auto sequence = block.sequence.load(std::memory_order_relaxed);
+    block.sequence.store(sequence + 1, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+
+    packUniversalCoord(observer.getPosition(), block.position);
+    block.orientation[0] = orientation.w();
+    block.orientation[1] = orientation.x();
+    block.orientation[2] = orientation.y();
+    block.orientation[3] = orientation.z();
+    block.time = sim->getTime();
+    block.timeScale = sim->getTimeScale();
+    block.selectionPointer = reinterpret_cast<jlong>(selectionObjectPointer(selection));
+    block.selectionType = static_cast<jint>(selection.getType());
+    // Saves readers a JNI call to pick the Java class for the selection
+    auto dso = selection.deepsky();
+    block.selectionIsGalaxy = dso != nullptr && dso->getObjType() == DeepSkyObjectType::Galaxy ? 1 : 0;
+    block.fov = observer.getFOV();
+    block.frame += 1;
+    block.published = 1;
+
+    block.sequence.store(sequence + 2, std::memory_order_release);
+}
+
+jobject ObserverStateFeed::newByteBuffer(JNIEnv *env)
+{
+    return env->NewDirectByteBuffer(&block, sizeof(block));
+}
+
+bool ObserverStateFeed::copyTo(void *destination) const
+{
+    auto bytes = static_cast<std::byte *>(destination);
+    constexpr auto payloadOffset = offsetof(ObserverStateBlock, published);
+    auto source = reinterpret_cast<const std::byte *>(&block);
+    for (int attempt = 0; attempt < maxCopyAttempts; ++attempt)
+    {
+        auto sequence = block.sequence.load(std::memory_order_acquire);
+        if ((sequence & 1) != 0)
+        {
+            std::this_thread::yield();
+            continue;
+        }
+        std::memcpy(bytes + payloadOffset, source + payloadOffset, sizeof(block) - payloadOffset);
+        std::atomic_thread_fence(std::memory_order_acquire);
+        if (block.sequence.load(std::memory_order_relaxed) == sequence)
+        {
+            std::memcpy(bytes, &sequence, sizeof(sequence));
+            return true;
+        }
+    }
+    return false;
+}
+
+extern "C"
+JNIEXPORT jboolean JNICALL
+Java_space_celestia_celestia_ObserverState_c_1copy(JNIEnv *env, jclass clazz, jlong pointer, jobject buffer) {
+    auto feed = reinterpret_cast<const ObserverStateFeed *>(pointer);
+    auto destination = env->GetDirectBufferAddress(buffer);
+    if (destination == nullptr || env->GetDirectBufferCapacity(buffer) < static_cast<jlong>(sizeof(ObserverStateBlock)))
+        return JNI_FALSE;
+    return feed->copyTo(destination) ? JNI_TRUE : JNI_FALSE;
+}
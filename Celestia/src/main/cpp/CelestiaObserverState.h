@@ -0,0 +1,60 @@
+// CelestiaObserverState.h
+//
+// Copyright (C) 2025, Celestia Development Team
+//
+// This program is free software; you can redistribute it and/or
+// modify it under the terms of the GNU General Public License
+// as published by the Free Software Foundation; either version 2
+// of the License, or (at your option) any later version.
+
+#pragma once
+
+#include "CelestiaJNI.h"
+#include "CelestiaUniversalCoord.h"
+
+#include <atomic>
+#include <cstdint>
+
+class CelestiaCore;
+
+// Observer state published by the render thread once per frame, read from
+// Java through a direct ByteBuffer without a JNI transition. The layout is
+// mirrored by the offsets in ObserverState.java, keep them in sync.
+struct ObserverStateBlock
+{
+    // Odd while the render thread is writing
+    std::atomic<uint32_t> sequence{ 0 };
+    uint32_t published{ 0 };
+    jlong position[UNIVERSAL_COORD_PACKED_LENGTH]{};
+    // w, x, y, z
+    double orientation[4]{};
+    double time{ 0.0 };
+    double timeScale{ 0.0 };
+    jlong selectionPointer{ 0 };
+    jint selectionType{ 0 };
+    // Non-zero when the selection is a galaxy
+    jint selectionIsGalaxy{ 0 };
+    double fov{ 0.0 };
+    jlong frame{ 0 };
+};
+
+class ObserverStateFeed
+{
+public:
+    ObserverStateFeed() = default;
+    ObserverStateFeed(const ObserverStateFeed &) = delete;
+    ObserverStateFeed &operator=(const ObserverStateFeed &) = delete;
+
+    // Nothing is published until a reader asks for the feed
+    void enable();
+    // Render thread only
+    void publish(CelestiaCore *core);
+
+    jobject newByteBuffer(JNIEnv *env);
+    // Returns false if no consistent copy could be made in a bounded number of tries
+    bool copyTo(void *destination) const;
+
+private:
+    ObserverStateBlock block;
+    std::atomic<bool> enabled{ false };
+};
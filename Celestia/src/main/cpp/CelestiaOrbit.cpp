@@ -8,6 +8,7 @@
 // of the License, or (at your option) any later version.
 
 #include "CelestiaVector.h"
+#include "CelestiaNativeMethods.h"
 #include <celephem/orbit.h>
 
 extern "C"
@@ -63,4 +64,15 @@ Java_space_celestia_celestia_Orbit_c_1getPositionAtTime(JNIEnv *env, jclass claz
     auto p = (const celestia::ephem::Orbit *)pointer;
     const Eigen::Vector3d v = p->positionAtTime(julian_day);
     return createVectorForVector3d(env, v);
-}
\ No newline at end of file
+}
+
+bool registerOrbitNativeMethods(JNIEnv *env) {
+    static const JNINativeMethod methods[] = {
+        CELESTIA_NATIVE_METHOD("c_isPeriodic", Java_space_celestia_celestia_Orbit_c_1isPeriodic),
+        CELESTIA_NATIVE_METHOD("c_getPeriod", Java_space_celestia_celestia_Orbit_c_1getPeriod),
+        CELESTIA_NATIVE_METHOD("c_getBoundingRadius", Java_space_celestia_celestia_Orbit_c_1getBoundingRadius),
+        CELESTIA_NATIVE_METHOD("c_getValidBeginTime", Java_space_celestia_celestia_Orbit_c_1getValidBeginTime),
+        CELESTIA_NATIVE_METHOD("c_getValidEndTime", Java_space_celestia_celestia_Orbit_c_1getValidEndTime),
+    };
+    return celestia::jni::registerNativeMethods(env, "space/celestia/celestia/Orbit", methods, std::size(methods));
+}
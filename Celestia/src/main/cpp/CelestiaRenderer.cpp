@@ -11,6 +11,7 @@
 #include <android/native_window.h>
 #include <android/native_window_jni.h>
 #include <cstring>
+#include <optional>
 #include <epoxy/egl.h>
 #include <epoxy/gl.h>
 #include <swappy/swappyGL.h>
@@ -25,6 +26,8 @@
 #define LOG_TAG "Renderer"
 
 #include "CelestiaJNI.h"
+#include "CelestiaObserverState.h"
+#include "CelestiaStartupProfiler.h"
 
 #ifndef NDEBUG
 static void KHRONOS_APIENTRY CelestiaKHRDebugCallback(GLenum source,
@@ -92,7 +95,7 @@ public:
     bool initialize();
     void destroy();
     inline void resizeIfNeeded(int windowWidth, int windowHeight);
-    inline void tickAndDraw() const;
+    inline void tickAndDraw();
     void start();
     void stop();
     inline void lock();
@@ -117,6 +120,8 @@ public:
 
     CelestiaCore *core = nullptr;
 
+    ObserverStateFeed observerState;
+
     enum RenderThreadMessage {
         MSG_NONE = 0,
         MSG_WINDOW_SET,
@@ -371,10 +376,23 @@ void CelestiaRenderer::resizeIfNeeded(int newWindowWidth, int newWindowHeight)
     }
 }
 
-void CelestiaRenderer::tickAndDraw() const
+void CelestiaRenderer::tickAndDraw()
 {
+    auto &profiler = StartupProfiler::shared();
+    std::optional<StartupPhaseScope> firstFramePhase;
+    if (profiler.isAwaitingFirstFrame())
+        firstFramePhase.emplace("First frame");
+
     core->tick();
+    // Publish what this frame is drawn with, no-op until someone reads it
+    observerState.publish(core);
     core->draw();
+
+    if (firstFramePhase.has_value())
+    {
+        firstFramePhase.reset();
+        profiler.finish();
+    }
 }
 
 void CelestiaRenderer::start()
@@ -1026,4 +1044,21 @@ Java_space_celestia_celestia_Renderer_c_1hasPresentationSurface(JNIEnv *env, job
                                                                  jlong pointer) {
     auto renderer = reinterpret_cast<CelestiaRenderer *>(pointer);
     return renderer->presentationSurface.surface != EGL_NO_SURFACE;
-}
\ No newline at end of file
+}
+
+extern "C"
+JNIEXPORT jobject JNICALL
+Java_space_celestia_celestia_Renderer_c_1getObserverStateBuffer(JNIEnv *env, jobject thiz,
+                                                                jlong pointer) {
+    auto renderer = reinterpret_cast<CelestiaRenderer *>(pointer);
+    return renderer->observerState.newByteBuffer(env);
+}
+
+extern "C"
+JNIEXPORT jlong JNICALL
+Java_space_celestia_celestia_Renderer_c_1getObserverStateFeed(JNIEnv *env, jobject thiz,
+                                                              jlong pointer) {
+    auto renderer = reinterpret_cast<CelestiaRenderer *>(pointer);
+    renderer->observerState.enable();
+    return reinterpret_cast<jlong>(&renderer->observerState);
+}
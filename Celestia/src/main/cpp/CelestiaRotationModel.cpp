@@ -8,6 +8,7 @@
 // of the License, or (at your option) any later version.
 
 #include "CelestiaVector.h"
+#include "CelestiaNativeMethods.h"
 #include <celephem/rotation.h>
 
 extern "C"
@@ -66,4 +67,14 @@ Java_space_celestia_celestia_RotationModel_c_1getSpinAtTime(JNIEnv *env, jclass
     auto p = (const celestia::ephem::RotationModel *)pointer;
     const Eigen::Quaterniond v = p->spin(julian_day);
     return createVectorForQuaterniond(env, v);
-}
\ No newline at end of file
+}
+
+bool registerRotationModelNativeMethods(JNIEnv *env) {
+    static const JNINativeMethod methods[] = {
+        CELESTIA_NATIVE_METHOD("c_isPeriodic", Java_space_celestia_celestia_RotationModel_c_1isPeriodic),
+        CELESTIA_NATIVE_METHOD("c_getPeriod", Java_space_celestia_celestia_RotationModel_c_1getPeriod),
+        CELESTIA_NATIVE_METHOD("c_getValidBeginTime", Java_space_celestia_celestia_RotationModel_c_1getValidBeginTime),
+        CELESTIA_NATIVE_METHOD("c_getValidEndTime", Java_space_celestia_celestia_RotationModel_c_1getValidEndTime),
+    };
+    return celestia::jni::registerNativeMethods(env, "space/celestia/celestia/RotationModel", methods, std::size(methods));
+}
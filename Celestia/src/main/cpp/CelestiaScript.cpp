@@ -8,6 +8,7 @@
 // of the License, or (at your option) any later version.
 
 #include "CelestiaJNI.h"
+#include "CelestiaStartupProfiler.h"
 #import <celestia/scriptmenu.h>
 
 extern "C"
@@ -16,6 +17,7 @@ Java_space_celestia_celestia_Script_c_1getScriptsInDirectory(JNIEnv *env,
                                                                                 jclass clazz,
                                                                                 jstring path,
                                                                                 jboolean deep_scan) {
+    StartupPhaseScope phase("Scripts menu");
     const char *str = env->GetStringUTFChars(path, nullptr);
     auto results = ScanScriptsDirectory(str, deep_scan != JNI_FALSE);
     env->ReleaseStringUTFChars(path, str);
@@ -34,27 +34,27 @@ Selection javaSelectionAsSelection(JNIEnv *env, jobject javaSelection)
     }
 }
 
-jobject selectionAsJavaSelection(JNIEnv *env, Selection const& sel)
+void *selectionObjectPointer(Selection const& sel)
 {
-    void *pointer = nullptr;
     switch (sel.getType())
     {
         case SelectionType::Body:
-            pointer = sel.body();
-            break;
+            return sel.body();
         case SelectionType::Star:
-            pointer = sel.star();
-            break;
+            return sel.star();
         case SelectionType::DeepSky:
-            pointer = sel.deepsky();
-            break;
+            return sel.deepsky();
         case SelectionType::Location:
-            pointer = sel.location();
-            break;
+            return sel.location();
         case SelectionType::None:
         default:
-            break;
+            return nullptr;
     }
+}
+
+jobject selectionAsJavaSelection(JNIEnv *env, Selection const& sel)
+{
+    void *pointer = selectionObjectPointer(sel);
     return env->NewObject(selectionClz, selectionInitMethodID, reinterpret_cast<jlong>(pointer), static_cast<jint>(sel.getType()));
 }
 
@@ -14,3 +14,4 @@
 
 Selection javaSelectionAsSelection(JNIEnv *env, jobject javaSelection);
 jobject selectionAsJavaSelection(JNIEnv *env, Selection const& sel);
+void *selectionObjectPointer(Selection const& sel);
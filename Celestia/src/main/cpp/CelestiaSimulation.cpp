@@ -7,10 +7,18 @@
 // as published by the Free Software Foundation; either version 2
 // of the License, or (at your option) any later version.
 
+#include "CelestiaSimulation.h"
 #include "CelestiaSelection.h"
+#include <algorithm>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <vector>
 #include <celengine/simulation.h>
 #include <celengine/selection.h>
 #include <celmath/geomutil.h>
+#include <celutil/greek.h>
+#include <celutil/utf8.h>
 
 extern "C"
 JNIEXPORT jobject JNICALL
@@ -35,20 +43,106 @@ Java_space_celestia_celestia_Simulation_c_1getUniverse(JNIEnv *env, jclass clazz
     return (jlong)sim->getUniverse();
 }
 
+// Results of the previous completion query. Completion is a prefix match, so
+// while the user keeps extending the text (and the context that decides which
+// solar system objects are offered is unchanged) the new results are a subset
+// of the previous ones and can be filtered instead of searching the catalogs.
+// The catalogs also match Greek letter abbreviations ("alp" for "α"), which a
+// plain prefix filter can not reproduce, such queries are always searched.
+struct CompletionCache
+{
+    const Simulation *sim{ nullptr };
+    Selection selection;
+    const SolarSystem *nearestSolarSystem{ nullptr };
+    std::string text;
+    std::vector<celestia::engine::Completion> results;
+};
+
+static std::mutex completionCacheMutex;
+static CompletionCache completionCache;
+
+void invalidateCompletionCache()
+{
+    std::scoped_lock lock(completionCacheMutex);
+    completionCache = CompletionCache();
+}
+
+static bool isCompletionCanceled(JNIEnv *env, jobject signal)
+{
+    if (signal == nullptr)
+        return false;
+
+    return env->CallBooleanMethod(signal, cancellationSignalIsCanceledMethodID) == JNI_TRUE;
+}
+
+static bool isPlainPrefixQuery(std::string_view text)
+{
+    // Path completion lists the children of an object
+    if (text.find('/') != std::string_view::npos)
+        return false;
+    // Greek letters typed directly also match their spelled out forms
+    if (std::any_of(text.begin(), text.end(), [](char c) { return static_cast<unsigned char>(c) >= 0x80; }))
+        return false;
+    return ReplaceGreekLetterAbbr(std::string(text)) == text;
+}
+
+static std::vector<celestia::engine::Completion> getObjectCompletion(const Simulation *sim, std::string_view text, std::size_t limit)
+{
+    std::scoped_lock lock(completionCacheMutex);
+    auto selection = sim->getSelection();
+    auto nearestSolarSystem = sim->getNearestSolarSystem();
+    bool canFilter = isPlainPrefixQuery(text)
+                  && completionCache.sim == sim
+                  && completionCache.selection == selection
+                  && completionCache.nearestSolarSystem == nearestSolarSystem
+                  && !completionCache.text.empty()
+                  && completionCache.text.find('/') == std::string::npos
+                  && text.size() >= completionCache.text.size()
+                  && text.compare(0, completionCache.text.size(), completionCache.text) == 0;
+
+    std::vector<celestia::engine::Completion> results;
+    if (canFilter)
+    {
+        for (const auto& completion : completionCache.results)
+        {
+            if (UTF8StartsWith(completion.getName(), text, true))
+                results.push_back(completion);
+        }
+    }
+    else
+    {
+        sim->getObjectCompletion(results, text, true);
+    }
+
+    completionCache.sim = sim;
+    completionCache.selection = selection;
+    completionCache.nearestSolarSystem = nearestSolarSystem;
+    completionCache.text = text;
+    completionCache.results = std::move(results);
+
+    const auto &cached = completionCache.results;
+    return { cached.begin(), cached.begin() + static_cast<std::ptrdiff_t>(std::min(limit, cached.size())) };
+}
+
 extern "C"
 JNIEXPORT jobject JNICALL
-Java_space_celestia_celestia_Simulation_c_1completionForText(JNIEnv *env, jclass clazz, jlong pointer, jstring text, jint limit) {
+Java_space_celestia_celestia_Simulation_c_1completionForText(JNIEnv *env, jclass clazz, jlong pointer, jstring text, jint limit, jobject cancellation_signal) {
     auto sim = reinterpret_cast<Simulation *>(pointer);
+    // A newer query has already been issued, skip the search altogether
+    if (isCompletionCanceled(env, cancellation_signal))
+        return env->NewObject(alClz, aliMethodID, 0);
+
     const char *str = env->GetStringUTFChars(text, nullptr);
-    std::vector<celestia::engine::Completion> results;
-    sim->getObjectCompletion(results, str, true);
+    auto results = getObjectCompletion(sim, str, static_cast<std::size_t>(std::max(limit, 0)));
     env->ReleaseStringUTFChars(text, str);
-    jobject arrayObject = env->NewObject(alClz, aliMethodID, (int)results.size());
-    int count = 0;
-    for (const auto& result : results) {
-        if (count > limit)
-            break;
 
+    if (isCompletionCanceled(env, cancellation_signal))
+        return env->NewObject(alClz, aliMethodID, 0);
+
+    auto count = static_cast<jint>(results.size());
+    jobject arrayObject = env->NewObject(alClz, aliMethodID, count);
+    for (jint i = 0; i < count; i++) {
+        const auto& result = results[i];
         auto selection = selectionAsJavaSelection(env, result.getSelection());
         auto name = env->NewStringUTF(result.getName().c_str());
         auto completion = env->NewObject(completionClz, completionInitMethodID, name, selection);
@@ -56,7 +150,6 @@ Java_space_celestia_celestia_Simulation_c_1completionForText(JNIEnv *env, jclass
         env->DeleteLocalRef(name);
         env->CallBooleanMethod(arrayObject, alaMethodID, completion);
         env->DeleteLocalRef(completion);
-        count += 1;
     }
     return arrayObject;
 }
@@ -0,0 +1,14 @@
+// CelestiaSimulation.h
+//
+// Copyright (C) 2025, Celestia Development Team
+//
+// This program is free software; you can redistribute it and/or
+// modify it under the terms of the GNU General Public License
+// as published by the Free Software Foundation; either version 2
+// of the License, or (at your option) any later version.
+
+#pragma once
+
+// Cached completion results hold selections that point into the catalogs,
+// drop them whenever objects may be replaced or names localized differently
+void invalidateCompletionCache();
@@ -7,16 +7,18 @@
 // as published by the Free Software Foundation; either version 2
 // of the License, or (at your option) any later version.
 
-#include "CelestiaJNI.h"
+#include "CelestiaUniversalCoord.h"
 #include <celengine/star.h>
-#include <celengine/univcoord.h>
 
 extern "C"
-JNIEXPORT jlong JNICALL
+JNIEXPORT void JNICALL
 Java_space_celestia_celestia_Star_c_1getPositionAtTime(JNIEnv *env, jclass clazz, jlong pointer,
-                                                                          jdouble julian_day) {
-    auto star = (Star *)pointer;
-    return (jlong)new UniversalCoord(star->getPosition(julian_day));
+                                                                          jdouble julian_day,
+                                                                          jlongArray position) {
+    auto star = reinterpret_cast<Star *>(pointer);
+    jlong packed[UNIVERSAL_COORD_PACKED_LENGTH];
+    packUniversalCoord(star->getPosition(julian_day), packed);
+    env->SetLongArrayRegion(position, 0, UNIVERSAL_COORD_PACKED_LENGTH, packed);
 }
 
 extern "C"
@@ -7,34 +7,311 @@
 // as published by the Free Software Foundation; either version 2
 // of the License, or (at your option) any later version.
 
-#include "CelestiaJNI.h"
+#include "CelestiaStarBrowser.h"
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <tuple>
+#include <celastro/astro.h>
+#include <celengine/solarsys.h>
+#include <celengine/star.h>
 #include <celengine/starbrowser.h>
+#include <celengine/stardb.h>
+#include <celengine/universe.h>
 
 #define BROWSER_MAX_STAR_COUNT          100
 
+namespace
+{
+
+constexpr float INITIAL_SEARCH_RADIUS   = 10.0f;    // ly
+constexpr float MAX_SEARCH_RADIUS       = 1.0e10f;  // ly, beyond any catalog
+constexpr float SEARCH_RADIUS_GROWTH    = 4.0f;
+
+// Keeps the BROWSER_MAX_STAR_COUNT stars with the smallest key, the worst
+// kept star is at the front so it can be replaced in O(log n).
+class BoundedStarHeap
+{
+public:
+    BoundedStarHeap() { entries.reserve(BROWSER_MAX_STAR_COUNT); }
+
+    void insert(const Star *star, float key)
+    {
+        if (entries.size() < BROWSER_MAX_STAR_COUNT)
+        {
+            entries.emplace_back(key, star);
+            std::push_heap(entries.begin(), entries.end());
+        }
+        else if (key < entries.front().first)
+        {
+            std::pop_heap(entries.begin(), entries.end());
+            entries.back() = { key, star };
+            std::push_heap(entries.begin(), entries.end());
+        }
+    }
+
+    bool full() const { return entries.size() == BROWSER_MAX_STAR_COUNT; }
+    float worstKey() const { return entries.front().first; }
+    void clear() { entries.clear(); }
+
+    std::vector<const Star *> sortedStars()
+    {
+        std::sort_heap(entries.begin(), entries.end());
+        std::vector<const Star *> stars;
+        stars.reserve(entries.size());
+        for (const auto &[_, star] : entries)
+            stars.push_back(star);
+        return stars;
+    }
+
+private:
+    std::vector<std::pair<float, const Star *>> entries;
+};
+
+class NearestStarHandler : public StarHandler
+{
+public:
+    explicit NearestStarHandler(BoundedStarHeap &heap) : heap(heap) {}
+
+    void process(const Star &star, float distance, float) override
+    {
+        if (star.getVisibility())
+            heap.insert(&star, distance);
+    }
+
+private:
+    BoundedStarHeap &heap;
+};
+
+class BrighterStarHandler : public StarHandler
+{
+public:
+    explicit BrighterStarHandler(BoundedStarHeap &heap) : heap(heap) {}
+
+    void process(const Star &star, float distance, float) override
+    {
+        if (star.getVisibility())
+            heap.insert(&star, star.getApparentMagnitude(distance));
+    }
+
+private:
+    BoundedStarHeap &heap;
+};
+
+// The radius that was sufficient for the last query of a kind, a query from a
+// position moved by d needs at most that radius + d, so small moves of the
+// observer are answered with a single tight octree pass. Identical queries
+// reuse the previous result directly.
+struct CachedQuery
+{
+    Eigen::Vector3f position;
+    float radius;
+    // Shared so a reader keeps the list alive while another query replaces it
+    std::shared_ptr<const std::vector<const Star *>> stars;
+};
+
+std::mutex cacheMutex;
+std::map<std::tuple<const StarDatabase *, StarBrowserQuery::Kind>, CachedQuery> queryCache;
+std::map<const StarDatabase *, float> brightestAbsoluteMagnitudes;
+
+float initialSearchRadius(const StarDatabase *stardb, StarBrowserQuery::Kind kind, const Eigen::Vector3f &position, std::shared_ptr<const std::vector<const Star *>> &cachedStars)
+{
+    std::scoped_lock lock(cacheMutex);
+    auto it = queryCache.find({ stardb, kind });
+    if (it == queryCache.end())
+        return INITIAL_SEARCH_RADIUS;
+
+    float moved = (position - it->second.position).norm();
+    if (moved == 0.0f)
+        cachedStars = it->second.stars;
+    return it->second.radius + moved;
+}
+
+void storeQuery(const StarDatabase *stardb, StarBrowserQuery::Kind kind, const Eigen::Vector3f &position, float radius, const std::vector<const Star *> &stars)
+{
+    std::scoped_lock lock(cacheMutex);
+    queryCache[{ stardb, kind }] = { position, radius, std::make_shared<const std::vector<const Star *>>(stars) };
+}
+
+float brightestAbsoluteMagnitude(const StarDatabase *stardb)
+{
+    std::scoped_lock lock(cacheMutex);
+    auto it = brightestAbsoluteMagnitudes.find(stardb);
+    if (it != brightestAbsoluteMagnitudes.end())
+        return it->second;
+
+    float brightest = std::numeric_limits<float>::max();
+    for (std::uint32_t i = 0; i < stardb->size(); i++)
+    {
+        const Star *star = stardb->getStar(i);
+        if (star->getVisibility())
+            brightest = std::min(brightest, star->getAbsoluteMagnitude());
+    }
+    brightestAbsoluteMagnitudes[stardb] = brightest;
+    return brightest;
+}
+
+}
+
+void invalidateStarBrowserCache()
+{
+    std::scoped_lock lock(cacheMutex);
+    queryCache.clear();
+    brightestAbsoluteMagnitudes.clear();
+}
+
+StarBrowserQuery::StarBrowserQuery(const Universe *universe, Kind kind, const UniversalCoord &position, double time) :
+    universe(universe),
+    kind(kind),
+    position(position),
+    time(time)
+{
+}
+
+std::vector<const Star *> StarBrowserQuery::getStars() const
+{
+    switch (kind)
+    {
+    case Kind::Nearest:
+        return findNearest();
+    case Kind::Brighter:
+        return findBrighter();
+    case Kind::WithPlanets:
+        return findWithPlanets();
+    case Kind::Brightest:
+        return findBrightest();
+    default:
+        return {};
+    }
+}
+
+std::vector<const Star *> StarBrowserQuery::findNearest() const
+{
+    const StarDatabase *stardb = universe->getStarCatalog();
+    Eigen::Vector3f obsPosition = position.toLy().cast<float>();
+
+    std::shared_ptr<const std::vector<const Star *>> cachedStars;
+    float radius = initialSearchRadius(stardb, kind, obsPosition, cachedStars);
+    if (cachedStars != nullptr)
+        return *cachedStars;
+
+    // Every star within the radius is reported, so once the heap is full it
+    // holds the exact nearest stars.
+    BoundedStarHeap heap;
+    NearestStarHandler handler(heap);
+    for (;;)
+    {
+        heap.clear();
+        stardb->findCloseStars(handler, obsPosition, radius);
+        if (heap.full() || radius >= MAX_SEARCH_RADIUS)
+            break;
+        radius *= SEARCH_RADIUS_GROWTH;
+    }
+
+    if (heap.full())
+        radius = heap.worstKey();
+    auto stars = heap.sortedStars();
+    storeQuery(stardb, kind, obsPosition, radius, stars);
+    return stars;
+}
+
+std::vector<const Star *> StarBrowserQuery::findBrighter() const
+{
+    const StarDatabase *stardb = universe->getStarCatalog();
+    Eigen::Vector3f obsPosition = position.toLy().cast<float>();
+
+    std::shared_ptr<const std::vector<const Star *>> cachedStars;
+    float radius = initialSearchRadius(stardb, kind, obsPosition, cachedStars);
+    if (cachedStars != nullptr)
+        return *cachedStars;
+
+    // A star beyond the distance at which the intrinsically brightest star in
+    // the catalog fades below the faintest kept star can not make the list.
+    float brightestAbsMag = brightestAbsoluteMagnitude(stardb);
+    BoundedStarHeap heap;
+    BrighterStarHandler handler(heap);
+    for (;;)
+    {
+        heap.clear();
+        stardb->findCloseStars(handler, obsPosition, radius);
+        if (radius >= MAX_SEARCH_RADIUS)
+            break;
+        if (!heap.full())
+        {
+            radius *= SEARCH_RADIUS_GROWTH;
+            continue;
+        }
+
+        float limit = celestia::astro::parsecsToLightYears(10.0f * std::pow(10.0f, (heap.worstKey() - brightestAbsMag) / 5.0f));
+        if (limit <= radius)
+            break;
+        radius = std::min(limit, MAX_SEARCH_RADIUS);
+    }
+
+    auto stars = heap.sortedStars();
+    storeQuery(stardb, kind, obsPosition, radius, stars);
+    return stars;
+}
+
+std::vector<const Star *> StarBrowserQuery::findWithPlanets() const
+{
+    // Only stars with a solar system qualify, so rank the solar system
+    // catalog instead of the star catalog. Same predicate as
+    // StarBrowser::Filter::WithPlanets: a visible star with a catalog entry.
+    Eigen::Vector3f obsPosition = position.toLy().cast<float>();
+    BoundedStarHeap heap;
+    for (const auto &[_, solarSystem] : *universe->getSolarSystemCatalog())
+    {
+        const Star *star = solarSystem->getStar();
+        if (star == nullptr || !star->getVisibility())
+            continue;
+        heap.insert(star, (star->getPosition() - obsPosition).norm());
+    }
+    return heap.sortedStars();
+}
+
+std::vector<const Star *> StarBrowserQuery::findBrightest() const
+{
+    celestia::engine::StarBrowser browser(universe);
+    browser.setComparison(celestia::engine::StarBrowser::Comparison::AbsoluteMagnitude);
+    browser.setFilter(celestia::engine::StarBrowser::Filter::Visible);
+    browser.setPosition(position);
+    browser.setTime(time);
+
+    std::vector<celestia::engine::StarBrowserRecord> records;
+    browser.populate(records);
+    std::vector<const Star *> stars;
+    stars.reserve(records.size());
+    for (const auto &record : records)
+        stars.push_back(record.star);
+    return stars;
+}
+
 extern "C"
 JNIEXPORT void JNICALL
 Java_space_celestia_celestia_StarBrowser_c_1destroy(JNIEnv *env, jclass clazz, jlong ptr) {
-    auto browser = reinterpret_cast<celestia::engine::StarBrowser *>(ptr);
+    auto browser = reinterpret_cast<StarBrowserQuery *>(ptr);
     delete browser;
 }
 
 extern "C"
 JNIEXPORT jobject JNICALL
 Java_space_celestia_celestia_StarBrowser_c_1getStars(JNIEnv *env, jclass clazz, jlong ptr) {
-    auto browser = reinterpret_cast<celestia::engine::StarBrowser *>(ptr);
-    std::vector<celestia::engine::StarBrowserRecord> records;
-    browser->populate(records);
-    if (records.empty())
+    auto browser = reinterpret_cast<StarBrowserQuery *>(ptr);
+    auto stars = browser->getStars();
+    if (stars.empty())
         return env->NewObject(alClz, aliMethodID, 0);
 
-    jobject arrayObject = env->NewObject(alClz, aliMethodID, static_cast<jint>(records.size()));
-    for (const auto &record : records)
-     {
-        jobject jstar = env->NewObject(csClz, csiMethodID, reinterpret_cast<jlong>(record.star));
+    jobject arrayObject = env->NewObject(alClz, aliMethodID, static_cast<jint>(stars.size()));
+    for (const auto star : stars)
+    {
+        jobject jstar = env->NewObject(csClz, csiMethodID, reinterpret_cast<jlong>(star));
         env->CallBooleanMethod(arrayObject, alaMethodID, jstar);
         env->DeleteLocalRef(jstar);
     }
 
     return arrayObject;
-}
\ No newline at end of file
+}
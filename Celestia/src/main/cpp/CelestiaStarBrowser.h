@@ -0,0 +1,52 @@
+// CelestiaStarBrowser.h
+//
+// Copyright (C) 2025, Celestia Development Team
+//
+// This program is free software; you can redistribute it and/or
+// modify it under the terms of the GNU General Public License
+// as published by the Free Software Foundation; either version 2
+// of the License, or (at your option) any later version.
+
+#pragma once
+
+#include "CelestiaJNI.h"
+#include <vector>
+#include <celengine/univcoord.h>
+
+class Star;
+class Universe;
+
+// Star lists for the browser. Nearest, brighter and with planets lists are
+// answered from the star octree (or the solar system catalog) with bounded
+// heaps instead of ranking the whole catalog, brightest falls back to
+// celestia::engine::StarBrowser since it does not depend on the position.
+class StarBrowserQuery
+{
+public:
+    enum class Kind : jint
+    {
+        Nearest     = 0,
+        Brighter    = 1,
+        Brightest   = 2,
+        WithPlanets = 3,
+    };
+
+    StarBrowserQuery(const Universe *universe, Kind kind, const UniversalCoord &position, double time);
+
+    std::vector<const Star *> getStars() const;
+
+private:
+    std::vector<const Star *> findNearest() const;
+    std::vector<const Star *> findBrighter() const;
+    std::vector<const Star *> findWithPlanets() const;
+    std::vector<const Star *> findBrightest() const;
+
+    const Universe *universe;
+    Kind kind;
+    UniversalCoord position;
+    double time;
+};
+
+// Cached query radii and results refer to the current catalogs, drop them
+// whenever the catalogs are loaded or modified
+void invalidateStarBrowserCache();
@@ -8,6 +8,7 @@
 // of the License, or (at your option) any later version.
 
 #include "CelestiaJNI.h"
+#include "CelestiaNameCache.h"
 #include <celengine/stardb.h>
 
 extern "C"
@@ -15,7 +16,9 @@ JNIEXPORT jstring JNICALL
 Java_space_celestia_celestia_StarCatalog_c_1getStarName(JNIEnv *env, jclass clazz, jlong ptr, jlong pointer,
                                                         jboolean localized) {
     auto d = reinterpret_cast<StarDatabase *>(ptr);
-    return env->NewStringUTF(d->getStarName(*reinterpret_cast<Star *>(pointer),localized == JNI_TRUE).c_str());
+    auto star = reinterpret_cast<Star *>(pointer);
+    bool isLocalized = localized == JNI_TRUE;
+    return cachedName(env, star, isLocalized ? CachedNameKind::LocalizedStar : CachedNameKind::Star, [d, star, isLocalized] { return d->getStarName(*star, isLocalized); });
 }
 
 extern "C"
@@ -0,0 +1,284 @@
+// CelestiaStartupProfiler.cpp
+//
+// Copyright (C) 2025, Celestia Development Team
+//
+// This program is free software; you can redistribute it and/or
+// modify it under the terms of the GNU General Public License
+// as published by the Free Software Foundation; either version 2
+// of the License, or (at your option) any later version.
+
+#include "CelestiaStartupProfiler.h"
+#include "CelestiaJNI.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <ctime>
+#include <fstream>
+
+#include <malloc.h>
+#include <unistd.h>
+
+#include <json.hpp>
+
+using json = nlohmann::json;
+
+namespace
+{
+
+double secondsFromTimespec(const timespec &ts)
+{
+    return static_cast<double>(ts.tv_sec) + static_cast<double>(ts.tv_nsec) * 1.0e-9;
+}
+
+}
+
+// rchar counts every byte returned by read() on this thread, whether it came
+// from storage or the page cache
+std::uint64_t threadBytesRead()
+{
+    char path[64];
+    std::snprintf(path, sizeof(path), "/proc/self/task/%d/io", static_cast<int>(gettid()));
+    FILE *file = std::fopen(path, "re");
+    if (file == nullptr) return 0;
+
+    unsigned long long bytes = 0;
+    char line[128];
+    while (std::fgets(line, sizeof(line), file) != nullptr)
+    {
+        if (std::sscanf(line, "rchar: %llu", &bytes) == 1)
+            break;
+    }
+    std::fclose(file);
+    return bytes;
+}
+
+StartupSample StartupSample::current()
+{
+    StartupSample sample;
+    sample.wallTime = std::chrono::duration<double>(std::chrono::steady_clock::now().time_since_epoch()).count();
+    timespec ts;
+    if (clock_gettime(CLOCK_THREAD_CPUTIME_ID, &ts) == 0)
+        sample.cpuTime = secondsFromTimespec(ts);
+    sample.bytesRead = threadBytesRead();
+    auto info = mallinfo();
+    sample.heapBytes = static_cast<std::uint64_t>(info.uordblks) + static_cast<std::uint64_t>(info.hblkhd);
+    return sample;
+}
+
+StartupProfiler &StartupProfiler::shared()
+{
+    static StartupProfiler profiler;
+    return profiler;
+}
+
+void StartupProfiler::setReportPath(std::string path)
+{
+    std::lock_guard<std::mutex> lock(mutex);
+    reportPath = std::move(path);
+}
+
+void StartupProfiler::start()
+{
+    std::lock_guard<std::mutex> lock(mutex);
+    if (reportPath.empty() || recording.load(std::memory_order_relaxed)) return;
+
+    awaitingFirstFrame.store(false, std::memory_order_relaxed);
+    data = StartupReportData();
+    phaseIndices.clear();
+    currentPhase.reset();
+    recording.store(true, std::memory_order_release);
+}
+
+void StartupProfiler::beginPhase(std::string name, const StartupSample &sample)
+{
+    if (!isRecording()) return;
+
+    endPhase(sample);
+    std::lock_guard<std::mutex> lock(mutex);
+    currentPhase.emplace(std::move(name), sample);
+}
+
+void StartupProfiler::endPhase(const StartupSample &sample)
+{
+    std::optional<std::pair<std::string, StartupSample>> phase;
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        phase.swap(currentPhase);
+    }
+    if (phase.has_value())
+        addPhase(phase->first, phase->second, sample);
+}
+
+void StartupProfiler::endPhase()
+{
+    if (!isRecording()) return;
+
+    bool hasPhase;
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        hasPhase = currentPhase.has_value();
+    }
+    if (hasPhase)
+        endPhase(StartupSample::current());
+}
+
+void StartupProfiler::addPhase(const std::string &name, const StartupSample &begin, const StartupSample &end)
+{
+    std::lock_guard<std::mutex> lock(mutex);
+    if (!recording.load(std::memory_order_relaxed)) return;
+
+    auto [index, inserted] = phaseIndices.try_emplace(name, data.phases.size());
+    if (inserted)
+        data.phases.emplace_back().name = name;
+
+    auto &phase = data.phases[index->second];
+    phase.wallTime += end.wallTime - begin.wallTime;
+    phase.cpuTime += end.cpuTime - begin.cpuTime;
+    phase.bytesRead += end.bytesRead >= begin.bytesRead ? end.bytesRead - begin.bytesRead : 0;
+    phase.heapBytesAtEnd = end.heapBytes;
+}
+
+void StartupProfiler::setObjectCounts(std::int64_t starCount, std::int64_t dsoCount)
+{
+    std::lock_guard<std::mutex> lock(mutex);
+    data.starCount = starCount;
+    data.dsoCount = dsoCount;
+}
+
+void StartupProfiler::simulationStarted()
+{
+    if (isRecording())
+        awaitingFirstFrame.store(true, std::memory_order_release);
+}
+
+bool StartupProfiler::isRecording() const
+{
+    return recording.load(std::memory_order_acquire);
+}
+
+bool StartupProfiler::isAwaitingFirstFrame() const
+{
+    return awaitingFirstFrame.load(std::memory_order_acquire);
+}
+
+void StartupProfiler::finish()
+{
+    endPhase();
+
+    StartupReportData finished;
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        if (!recording.load(std::memory_order_relaxed)) return;
+
+        awaitingFirstFrame.store(false, std::memory_order_release);
+        recording.store(false, std::memory_order_release);
+        data.complete = true;
+        finished = data;
+    }
+    writeReport(finished);
+}
+
+StartupReportData StartupProfiler::report() const
+{
+    std::lock_guard<std::mutex> lock(mutex);
+    return data;
+}
+
+void StartupProfiler::writeReport(const StartupReportData &report) const
+{
+    std::string path;
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        path = reportPath;
+    }
+    if (path.empty()) return;
+
+    json phases = json::array();
+    for (const auto &phase : report.phases)
+    {
+        json item;
+        item["name"] = phase.name;
+        item["wallTime"] = phase.wallTime;
+        item["cpuTime"] = phase.cpuTime;
+        item["bytesRead"] = phase.bytesRead;
+        item["heapBytesAtEnd"] = phase.heapBytesAtEnd;
+        phases.push_back(item);
+    }
+    json j;
+    j["starCount"] = report.starCount;
+    j["dsoCount"] = report.dsoCount;
+    j["phases"] = phases;
+
+    std::ofstream out(path, std::ios::out | std::ios::trunc);
+    if (out.good())
+        out << j.dump(2) << '\n';
+}
+
+StartupPhaseScope::StartupPhaseScope(const char *name) : name(name)
+{
+    if (StartupProfiler::shared().isRecording())
+        begin = StartupSample::current();
+}
+
+StartupPhaseScope::~StartupPhaseScope()
+{
+    if (begin.has_value() && StartupProfiler::shared().isRecording())
+        StartupProfiler::shared().addPhase(name, *begin, StartupSample::current());
+}
+
+// Must match StartupReport.java
+constexpr jsize STARTUP_PHASE_DOUBLE_COUNT = 2;
+constexpr jsize STARTUP_PHASE_LONG_COUNT = 2;
+
+extern "C"
+JNIEXPORT void JNICALL
+Java_space_celestia_celestia_AppCore_c_1setStartupReportPath(JNIEnv *env, jclass clazz, jstring path) {
+    std::string reportPath;
+    if (path != nullptr)
+    {
+        const char *c_str = env->GetStringUTFChars(path, nullptr);
+        reportPath = c_str;
+        env->ReleaseStringUTFChars(path, c_str);
+    }
+    StartupProfiler::shared().setReportPath(std::move(reportPath));
+}
+
+extern "C"
+JNIEXPORT jint JNICALL
+Java_space_celestia_celestia_StartupReport_c_1getPhaseCount(JNIEnv *env, jclass clazz) {
+    return static_cast<jint>(StartupProfiler::shared().report().phases.size());
+}
+
+extern "C"
+JNIEXPORT jint JNICALL
+Java_space_celestia_celestia_StartupReport_c_1getReport(JNIEnv *env, jclass clazz,
+                                                         jobjectArray names,
+                                                         jdoubleArray doubles,
+                                                         jlongArray longs,
+                                                         jlongArray totals) {
+    auto report = StartupProfiler::shared().report();
+    // Phases may have been added since the arrays were sized
+    jsize count = std::min(static_cast<jsize>(report.phases.size()), env->GetArrayLength(names));
+
+    std::vector<jdouble> phaseDoubles(static_cast<std::size_t>(count * STARTUP_PHASE_DOUBLE_COUNT));
+    std::vector<jlong> phaseLongs(static_cast<std::size_t>(count * STARTUP_PHASE_LONG_COUNT));
+    for (jsize i = 0; i < count; i++)
+    {
+        const auto &phase = report.phases[static_cast<std::size_t>(i)];
+        jstring name = env->NewStringUTF(phase.name.c_str());
+        env->SetObjectArrayElement(names, i, name);
+        env->DeleteLocalRef(name);
+
+        phaseDoubles[static_cast<std::size_t>(i * STARTUP_PHASE_DOUBLE_COUNT)] = phase.wallTime;
+        phaseDoubles[static_cast<std::size_t>(i * STARTUP_PHASE_DOUBLE_COUNT + 1)] = phase.cpuTime;
+        phaseLongs[static_cast<std::size_t>(i * STARTUP_PHASE_LONG_COUNT)] = static_cast<jlong>(phase.bytesRead);
+        phaseLongs[static_cast<std::size_t>(i * STARTUP_PHASE_LONG_COUNT + 1)] = static_cast<jlong>(phase.heapBytesAtEnd);
+    }
+    env->SetDoubleArrayRegion(doubles, 0, static_cast<jsize>(phaseDoubles.size()), phaseDoubles.data());
+    env->SetLongArrayRegion(longs, 0, static_cast<jsize>(phaseLongs.size()), phaseLongs.data());
+
+    jlong reportTotals[] = { report.starCount, report.dsoCount, report.complete ? 1 : 0 };
+    env->SetLongArrayRegion(totals, 0, 3, reportTotals);
+    return count;
+}
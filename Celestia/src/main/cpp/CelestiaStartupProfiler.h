@@ -0,0 +1,113 @@
+// CelestiaStartupProfiler.h
+//
+// Copyright (C) 2025, Celestia Development Team
+//
+// This program is free software; you can redistribute it and/or
+// modify it under the terms of the GNU General Public License
+// as published by the Free Software Foundation; either version 2
+// of the License, or (at your option) any later version.
+
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+// Resource usage of the calling thread at one point in time
+struct StartupSample
+{
+    double wallTime{ 0.0 };
+    double cpuTime{ 0.0 };
+    std::uint64_t bytesRead{ 0 };
+    std::uint64_t heapBytes{ 0 };
+
+    static StartupSample current();
+};
+
+// Bytes returned by read() on the calling thread since it started
+std::uint64_t threadBytesRead();
+
+struct StartupPhase
+{
+    std::string name;
+    // Seconds
+    double wallTime{ 0.0 };
+    double cpuTime{ 0.0 };
+    std::uint64_t bytesRead{ 0 };
+    // Heap in use when the phase last ended, not a peak
+    std::uint64_t heapBytesAtEnd{ 0 };
+};
+
+struct StartupReportData
+{
+    std::vector<StartupPhase> phases;
+    std::int64_t starCount{ 0 };
+    std::int64_t dsoCount{ 0 };
+    bool complete{ false };
+};
+
+// Records where startup time goes, from startSimulation to the first frame
+// drawn. Phases are either sequential on the loading thread (one per
+// progress status reported by the core) or scoped with StartupPhaseScope.
+// Phases with the same name are merged. Recording is opt-in: nothing is
+// sampled unless a report path is set before start(). The report is written
+// as JSON to that path once the first frame is drawn.
+class StartupProfiler
+{
+public:
+    static StartupProfiler &shared();
+
+    void setReportPath(std::string path);
+
+    // Starts a new report unless one is already being recorded, e.g. when
+    // loading is retried with the fallback configuration
+    void start();
+    // Ends the current sequential phase, if any, and begins the next one,
+    // using the same sample for both boundaries
+    void beginPhase(std::string name, const StartupSample &sample);
+    void endPhase(const StartupSample &sample);
+    void endPhase();
+    void addPhase(const std::string &name, const StartupSample &begin, const StartupSample &end);
+    void setObjectCounts(std::int64_t starCount, std::int64_t dsoCount);
+
+    void simulationStarted();
+    bool isRecording() const;
+    bool isAwaitingFirstFrame() const;
+    void finish();
+
+    StartupReportData report() const;
+
+private:
+    StartupProfiler() = default;
+
+    void writeReport(const StartupReportData &data) const;
+
+    mutable std::mutex mutex;
+    // Checked on every frame and progress update without taking the mutex
+    std::atomic<bool> recording{ false };
+    std::atomic<bool> awaitingFirstFrame{ false };
+    std::string reportPath;
+    StartupReportData data;
+    // Position of each phase in data.phases, by name
+    std::unordered_map<std::string, std::size_t> phaseIndices;
+
+    std::optional<std::pair<std::string, StartupSample>> currentPhase;
+};
+
+class StartupPhaseScope
+{
+public:
+    explicit StartupPhaseScope(const char *name);
+    ~StartupPhaseScope();
+
+    StartupPhaseScope(const StartupPhaseScope &) = delete;
+    StartupPhaseScope &operator=(const StartupPhaseScope &) = delete;
+
+private:
+    const char *name;
+    std::optional<StartupSample> begin;
+};
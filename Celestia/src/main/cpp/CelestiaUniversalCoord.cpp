@@ -7,42 +7,66 @@
 // as published by the Free Software Foundation; either version 2
 // of the License, or (at your option) any later version.
 
+#include "CelestiaUniversalCoord.h"
 #include "CelestiaVector.h"
-#include <celengine/univcoord.h>
 
-extern "C"
-JNIEXPORT void JNICALL
-Java_space_celestia_celestia_UniversalCoord_c_1destroy(JNIEnv *env, jclass clazz, jlong pointer) {
-    auto ptr = (UniversalCoord *)pointer;
-    delete ptr;
+namespace
+{
+
+void packR128(const R128 &value, jlong *packed)
+{
+    packed[0] = static_cast<jlong>(value.lo);
+    packed[1] = static_cast<jlong>(value.hi);
 }
 
-extern "C"
-JNIEXPORT jlong JNICALL
-Java_space_celestia_celestia_UniversalCoord_c_1getZero(JNIEnv *env,
-                                                                  jclass clazz) {
-    return (jlong)new UniversalCoord(UniversalCoord::Zero());
+R128 unpackR128(const jlong *packed)
+{
+    R128 value;
+    value.lo = static_cast<R128_U64>(packed[0]);
+    value.hi = static_cast<R128_U64>(packed[1]);
+    return value;
+}
+
+UniversalCoord universalCoordFromArray(JNIEnv *env, jlongArray array)
+{
+    jlong packed[UNIVERSAL_COORD_PACKED_LENGTH];
+    env->GetLongArrayRegion(array, 0, UNIVERSAL_COORD_PACKED_LENGTH, packed);
+    return unpackUniversalCoord(packed);
+}
+
+}
+
+void packUniversalCoord(const UniversalCoord &coord, jlong *packed)
+{
+    packR128(coord.x, packed);
+    packR128(coord.y, packed + 2);
+    packR128(coord.z, packed + 4);
+}
+
+UniversalCoord unpackUniversalCoord(const jlong *packed)
+{
+    return UniversalCoord(unpackR128(packed), unpackR128(packed + 2), unpackR128(packed + 4));
 }
 
 extern "C"
 JNIEXPORT jdouble JNICALL
 Java_space_celestia_celestia_UniversalCoord_c_1distanceFrom(JNIEnv *env,
                                                                        jclass clazz,
-                                                                       jlong ptr1,
-                                                                       jlong ptr2) {
-    UniversalCoord *u1 = (UniversalCoord *)ptr1;
-    UniversalCoord *u2 = (UniversalCoord *)ptr2;
-    return u1->distanceFromKm(*u2);
+                                                                       jlongArray coord1,
+                                                                       jlongArray coord2) {
+    UniversalCoord u1 = universalCoordFromArray(env, coord1);
+    UniversalCoord u2 = universalCoordFromArray(env, coord2);
+    return u1.distanceFromKm(u2);
 }
 
 extern "C"
 JNIEXPORT jobject JNICALL
 Java_space_celestia_celestia_UniversalCoord_c_1offsetFrom(JNIEnv *env,
                                                                      jclass clazz,
-                                                                     jlong ptr1,
-                                                                     jlong ptr2) {
-    UniversalCoord *u1 = (UniversalCoord *)ptr1;
-    UniversalCoord *u2 = (UniversalCoord *)ptr2;
-    Eigen::Vector3d offset = u1->offsetFromKm(*u2);
+                                                                     jlongArray coord1,
+                                                                     jlongArray coord2) {
+    UniversalCoord u1 = universalCoordFromArray(env, coord1);
+    UniversalCoord u2 = universalCoordFromArray(env, coord2);
+    Eigen::Vector3d offset = u1.offsetFromKm(u2);
     return createVectorForVector3d(env, offset);
-}
\ No newline at end of file
+}
@@ -0,0 +1,20 @@
+// CelestiaUniversalCoord.h
+//
+// Copyright (C) 2025, Celestia Development Team
+//
+// This program is free software; you can redistribute it and/or
+// modify it under the terms of the GNU General Public License
+// as published by the Free Software Foundation; either version 2
+// of the License, or (at your option) any later version.
+
+#pragma once
+
+#include "CelestiaJNI.h"
+#include <celengine/univcoord.h>
+
+// UniversalCoord is passed to Java by value as six longs, the low and high
+// 64 bits of the x, y and z 128-bit fixed point components.
+constexpr jsize UNIVERSAL_COORD_PACKED_LENGTH = 6;
+
+void packUniversalCoord(const UniversalCoord &coord, jlong *packed);
+UniversalCoord unpackUniversalCoord(const jlong *packed);
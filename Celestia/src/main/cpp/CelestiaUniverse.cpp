@@ -8,10 +8,10 @@
 // of the License, or (at your option) any later version.
 
 #include "CelestiaSelection.h"
+#include "CelestiaStarBrowser.h"
 #include <celengine/body.h>
 #include <celengine/location.h>
 #include <celengine/observer.h>
-#include <celengine/starbrowser.h>
 #include <celengine/universe.h>
 #include <celutil/gettext.h>
 
@@ -39,36 +39,9 @@ extern "C"
 JNIEXPORT jlong JNICALL
 Java_space_celestia_celestia_Universe_c_1getStarBrowser(JNIEnv *env, jclass clazz, jlong pointer,
                                                         jint kind, jlong observer) {
-    const jint KIND_NEAREST       = 0;
-    const jint KIND_BRIGHTER      = 1;
-    const jint KIND_BRIGHTEST     = 2;
-    const jint KIND_WITH_PLANETS  = 3;
     auto u = reinterpret_cast<Universe *>(pointer);
     auto o = reinterpret_cast<Observer *>(observer);
-    auto b = new celestia::engine::StarBrowser(u);
-    switch (kind)
-    {
-    case KIND_NEAREST:
-        b->setComparison(celestia::engine::StarBrowser::Comparison::Nearest);
-        b->setFilter(celestia::engine::StarBrowser::Filter::Visible);
-        break;
-    case KIND_BRIGHTER:
-        b->setComparison(celestia::engine::StarBrowser::Comparison::ApparentMagnitude);
-        b->setFilter(celestia::engine::StarBrowser::Filter::Visible);
-        break;
-    case KIND_BRIGHTEST:
-        b->setComparison(celestia::engine::StarBrowser::Comparison::AbsoluteMagnitude);
-        b->setFilter(celestia::engine::StarBrowser::Filter::Visible);
-        break;
-    case KIND_WITH_PLANETS:
-        b->setComparison(celestia::engine::StarBrowser::Comparison::Nearest);
-        b->setFilter(celestia::engine::StarBrowser::Filter::WithPlanets);
-        break;
-    default:
-        break;
-    }
-    b->setPosition(o->getPosition());
-    b->setTime(o->getTime());
+    auto b = new StarBrowserQuery(u, static_cast<StarBrowserQuery::Kind>(kind), o->getPosition(), o->getTime());
     return reinterpret_cast<jlong>(b);
 }
 
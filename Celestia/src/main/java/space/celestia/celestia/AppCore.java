@@ -12,6 +12,8 @@ package space.celestia.celestia;
 import android.graphics.PointF;
 import android.util.Log;
 
+import dalvik.annotation.optimization.FastNative;
+
 import androidx.annotation.NonNull;
 import androidx.annotation.Nullable;
 
@@ -58,6 +60,11 @@ public class AppCore {
 
     public interface ProgressWatcher {
         void onCelestiaProgress(@NonNull String progress);
+
+        // Catalog bytes loaded so far, bytesTotal is -1 while the total is not known yet
+        default void onCelestiaProgress(@NonNull String progress, long bytesDone, long bytesTotal) {
+            onCelestiaProgress(progress);
+        }
     }
 
     public interface ContextMenuHandler {
@@ -264,6 +271,11 @@ public class AppCore {
     }
     public static void chdir(String path) { c_chdir(path);}
 
+    // Startup report, written as JSON to path once the first frame is drawn.
+    // Startup is only profiled while a path is set
+    public static void setStartupReportPath(@Nullable String path) { c_setStartupReportPath(path); }
+    public static @NonNull StartupReport getStartupReport() { return StartupReport.current(); }
+
     public boolean saveScreenshot(@NonNull String filePath, int imageType) {
         return c_saveScreenshot(pointer, filePath, imageType);
     }
@@ -272,6 +284,9 @@ public class AppCore {
     public static @NonNull String getLanguage() { return c_getLanguage(); };
     public static void setLocaleDirectoryPath(@NonNull String localeDirectoryPath, @NonNull String locale, @NonNull String country) { c_setLocaleDirectoryPath(localeDirectoryPath, locale, country); }
     public static void setUpLocale() { c_setUpLocale(); }
+
+    // Level from ComponentCallbacks2.onTrimMemory
+    public static void trimMemory(int level) { c_trimMemory(level); }
     public static @NonNull String getLocalizedString(@NonNull String string) { return c_getLocalizedString(string, "celestia_ui"); }
     public static @NonNull String getLocalizedString(@NonNull String string, @NonNull String context) { return c_getLocalizedStringContext(string, context, "celestia_ui"); }
 
@@ -287,6 +302,22 @@ public class AppCore {
         return c_getRenderInfo(pointer);
     }
 
+    // Render settings
+    public @NonNull RenderSettings getRenderSettings() {
+        RenderSettings settings = new RenderSettings();
+        c_getRenderSettings(pointer, settings.booleans, settings.ints, settings.doubles);
+        return settings;
+    }
+
+    // Writes only the entries changed since the snapshot was taken (or last applied).
+    // Like the other setters it runs on the calling thread, callers are expected to
+    // be on the Celestia executor.
+    public void applyRenderSettings(@NonNull RenderSettings settings) {
+        if (!settings.hasChanges()) return;
+        c_applyRenderSettings(pointer, settings.booleans, settings.changedBooleanIndices(), settings.ints, settings.changedIntIndices(), settings.doubles, settings.changedDoubleIndices());
+        settings.clearChanges();
+    }
+
     public @NonNull List<Destination> getDestinations() {
         return c_getDestinations(pointer);
     }
@@ -342,12 +373,14 @@ public class AppCore {
 
     private static native boolean c_initGL();
     private static native void c_chdir(String path);
+    private static native void c_setStartupReportPath(String path);
 
     private static native List<Destination> c_getDestinations(long ptr);
 
     // Locale
     private static native String c_getLanguage();
     private static native void c_setLocaleDirectoryPath(String path, String locale, String country);
+    private static native void c_trimMemory(int level);
     private static native void c_setUpLocale();
     private static native String c_getLocalizedString(String string, String domain);
     private static native String c_getLocalizedStringContext(String string, String context, String domain);
@@ -355,6 +388,9 @@ public class AppCore {
 
     private static native String c_getRenderInfo(long ptr);
 
+    private static native void c_getRenderSettings(long ptr, boolean[] booleans, int[] ints, double[] doubles);
+    private static native void c_applyRenderSettings(long ptr, boolean[] booleans, int[] changedBooleans, int[] ints, int[] changedInts, double[] doubles, int[] changedDoubles);
+
     private static native boolean c_saveScreenshot(long ptr, String filePath, int imageType);
 
     private final static String TAG = "CelestiaAppCore";
@@ -422,484 +458,722 @@ public class AppCore {
 
     public boolean getShowStars() { return c_getShowStars(pointer); }
     public void setShowStars(boolean showStars) { c_setShowStars(pointer, showStars); }
+    @FastNative
     private static native void c_setShowStars(long pointer, boolean showStars);
+    @FastNative
     private native boolean c_getShowStars(long pointer);
     public boolean getShowPlanets() { return c_getShowPlanets(pointer); }
     public void setShowPlanets(boolean showPlanets) { c_setShowPlanets(pointer, showPlanets); }
+    @FastNative
     private static native void c_setShowPlanets(long pointer, boolean showPlanets);
+    @FastNative
     private native boolean c_getShowPlanets(long pointer);
     public boolean getShowDwarfPlanets() { return c_getShowDwarfPlanets(pointer); }
     public void setShowDwarfPlanets(boolean showDwarfPlanets) { c_setShowDwarfPlanets(pointer, showDwarfPlanets); }
+    @FastNative
     private static native void c_setShowDwarfPlanets(long pointer, boolean showDwarfPlanets);
+    @FastNative
     private native boolean c_getShowDwarfPlanets(long pointer);
     public boolean getShowMoons() { return c_getShowMoons(pointer); }
     public void setShowMoons(boolean showMoons) { c_setShowMoons(pointer, showMoons); }
+    @FastNative
     private static native void c_setShowMoons(long pointer, boolean showMoons);
+    @FastNative
     private native boolean c_getShowMoons(long pointer);
     public boolean getShowMinorMoons() { return c_getShowMinorMoons(pointer); }
     public void setShowMinorMoons(boolean showMinorMoons) { c_setShowMinorMoons(pointer, showMinorMoons); }
+    @FastNative
     private static native void c_setShowMinorMoons(long pointer, boolean showMinorMoons);
+    @FastNative
     private native boolean c_getShowMinorMoons(long pointer);
     public boolean getShowAsteroids() { return c_getShowAsteroids(pointer); }
     public void setShowAsteroids(boolean showAsteroids) { c_setShowAsteroids(pointer, showAsteroids); }
+    @FastNative
     private static native void c_setShowAsteroids(long pointer, boolean showAsteroids);
+    @FastNative
     private native boolean c_getShowAsteroids(long pointer);
     public boolean getShowComets() { return c_getShowComets(pointer); }
     public void setShowComets(boolean showComets) { c_setShowComets(pointer, showComets); }
+    @FastNative
     private static native void c_setShowComets(long pointer, boolean showComets);
+    @FastNative
     private native boolean c_getShowComets(long pointer);
     public boolean getShowSpacecrafts() { return c_getShowSpacecrafts(pointer); }
     public void setShowSpacecrafts(boolean showSpacecrafts) { c_setShowSpacecrafts(pointer, showSpacecrafts); }
+    @FastNative
     private static native void c_setShowSpacecrafts(long pointer, boolean showSpacecrafts);
+    @FastNative
     private native boolean c_getShowSpacecrafts(long pointer);
     public boolean getShowGalaxies() { return c_getShowGalaxies(pointer); }
     public void setShowGalaxies(boolean showGalaxies) { c_setShowGalaxies(pointer, showGalaxies); }
+    @FastNative
     private static native void c_setShowGalaxies(long pointer, boolean showGalaxies);
+    @FastNative
     private native boolean c_getShowGalaxies(long pointer);
     public boolean getShowGlobulars() { return c_getShowGlobulars(pointer); }
     public void setShowGlobulars(boolean showGlobulars) { c_setShowGlobulars(pointer, showGlobulars); }
+    @FastNative
     private static native void c_setShowGlobulars(long pointer, boolean showGlobulars);
+    @FastNative
     private native boolean c_getShowGlobulars(long pointer);
     public boolean getShowNebulae() { return c_getShowNebulae(pointer); }
     public void setShowNebulae(boolean showNebulae) { c_setShowNebulae(pointer, showNebulae); }
+    @FastNative
     private static native void c_setShowNebulae(long pointer, boolean showNebulae);
+    @FastNative
     private native boolean c_getShowNebulae(long pointer);
     public boolean getShowOpenClusters() { return c_getShowOpenClusters(pointer); }
     public void setShowOpenClusters(boolean showOpenClusters) { c_setShowOpenClusters(pointer, showOpenClusters); }
+    @FastNative
     private static native void c_setShowOpenClusters(long pointer, boolean showOpenClusters);
+    @FastNative
     private native boolean c_getShowOpenClusters(long pointer);
     public boolean getShowDiagrams() { return c_getShowDiagrams(pointer); }
     public void setShowDiagrams(boolean showDiagrams) { c_setShowDiagrams(pointer, showDiagrams); }
+    @FastNative
     private static native void c_setShowDiagrams(long pointer, boolean showDiagrams);
+    @FastNative
     private native boolean c_getShowDiagrams(long pointer);
     public boolean getShowBoundaries() { return c_getShowBoundaries(pointer); }
     public void setShowBoundaries(boolean showBoundaries) { c_setShowBoundaries(pointer, showBoundaries); }
+    @FastNative
     private static native void c_setShowBoundaries(long pointer, boolean showBoundaries);
+    @FastNative
     private native boolean c_getShowBoundaries(long pointer);
     public boolean getShowCloudMaps() { return c_getShowCloudMaps(pointer); }
     public void setShowCloudMaps(boolean showCloudMaps) { c_setShowCloudMaps(pointer, showCloudMaps); }
+    @FastNative
     private static native void c_setShowCloudMaps(long pointer, boolean showCloudMaps);
+    @FastNative
     private native boolean c_getShowCloudMaps(long pointer);
     public boolean getShowNightMaps() { return c_getShowNightMaps(pointer); }
     public void setShowNightMaps(boolean showNightMaps) { c_setShowNightMaps(pointer, showNightMaps); }
+    @FastNative
     private static native void c_setShowNightMaps(long pointer, boolean showNightMaps);
+    @FastNative
     private native boolean c_getShowNightMaps(long pointer);
     public boolean getShowAtmospheres() { return c_getShowAtmospheres(pointer); }
     public void setShowAtmospheres(boolean showAtmospheres) { c_setShowAtmospheres(pointer, showAtmospheres); }
+    @FastNative
     private static native void c_setShowAtmospheres(long pointer, boolean showAtmospheres);
+    @FastNative
     private native boolean c_getShowAtmospheres(long pointer);
     public boolean getShowCometTails() { return c_getShowCometTails(pointer); }
     public void setShowCometTails(boolean showCometTails) { c_setShowCometTails(pointer, showCometTails); }
+    @FastNative
     private static native void c_setShowCometTails(long pointer, boolean showCometTails);
+    @FastNative
     private native boolean c_getShowCometTails(long pointer);
     public boolean getShowPlanetRings() { return c_getShowPlanetRings(pointer); }
     public void setShowPlanetRings(boolean showPlanetRings) { c_setShowPlanetRings(pointer, showPlanetRings); }
+    @FastNative
     private static native void c_setShowPlanetRings(long pointer, boolean showPlanetRings);
+    @FastNative
     private native boolean c_getShowPlanetRings(long pointer);
     public boolean getShowMarkers() { return c_getShowMarkers(pointer); }
     public void setShowMarkers(boolean showMarkers) { c_setShowMarkers(pointer, showMarkers); }
+    @FastNative
     private static native void c_setShowMarkers(long pointer, boolean showMarkers);
+    @FastNative
     private native boolean c_getShowMarkers(long pointer);
     public boolean getShowOrbits() { return c_getShowOrbits(pointer); }
     public void setShowOrbits(boolean showOrbits) { c_setShowOrbits(pointer, showOrbits); }
+    @FastNative
     private static native void c_setShowOrbits(long pointer, boolean showOrbits);
+    @FastNative
     private native boolean c_getShowOrbits(long pointer);
     public boolean getShowFadingOrbits() { return c_getShowFadingOrbits(pointer); }
     public void setShowFadingOrbits(boolean showFadingOrbits) { c_setShowFadingOrbits(pointer, showFadingOrbits); }
+    @FastNative
     private static native void c_setShowFadingOrbits(long pointer, boolean showFadingOrbits);
+    @FastNative
     private native boolean c_getShowFadingOrbits(long pointer);
     public boolean getShowPartialTrajectories() { return c_getShowPartialTrajectories(pointer); }
     public void setShowPartialTrajectories(boolean showPartialTrajectories) { c_setShowPartialTrajectories(pointer, showPartialTrajectories); }
+    @FastNative
     private static native void c_setShowPartialTrajectories(long pointer, boolean showPartialTrajectories);
+    @FastNative
     private native boolean c_getShowPartialTrajectories(long pointer);
     public boolean getShowSmoothLines() { return c_getShowSmoothLines(pointer); }
     public void setShowSmoothLines(boolean showSmoothLines) { c_setShowSmoothLines(pointer, showSmoothLines); }
+    @FastNative
     private static native void c_setShowSmoothLines(long pointer, boolean showSmoothLines);
+    @FastNative
     private native boolean c_getShowSmoothLines(long pointer);
     public boolean getShowEclipseShadows() { return c_getShowEclipseShadows(pointer); }
     public void setShowEclipseShadows(boolean showEclipseShadows) { c_setShowEclipseShadows(pointer, showEclipseShadows); }
+    @FastNative
     private static native void c_setShowEclipseShadows(long pointer, boolean showEclipseShadows);
+    @FastNative
     private native boolean c_getShowEclipseShadows(long pointer);
     public boolean getShowRingShadows() { return c_getShowRingShadows(pointer); }
     public void setShowRingShadows(boolean showRingShadows) { c_setShowRingShadows(pointer, showRingShadows); }
+    @FastNative
     private static native void c_setShowRingShadows(long pointer, boolean showRingShadows);
+    @FastNative
     private native boolean c_getShowRingShadows(long pointer);
     public boolean getShowCloudShadows() { return c_getShowCloudShadows(pointer); }
     public void setShowCloudShadows(boolean showCloudShadows) { c_setShowCloudShadows(pointer, showCloudShadows); }
+    @FastNative
     private static native void c_setShowCloudShadows(long pointer, boolean showCloudShadows);
+    @FastNative
     private native boolean c_getShowCloudShadows(long pointer);
     public boolean getShowAutoMag() { return c_getShowAutoMag(pointer); }
     public void setShowAutoMag(boolean showAutoMag) { c_setShowAutoMag(pointer, showAutoMag); }
+    @FastNative
     private static native void c_setShowAutoMag(long pointer, boolean showAutoMag);
+    @FastNative
     private native boolean c_getShowAutoMag(long pointer);
     public boolean getShowCelestialSphere() { return c_getShowCelestialSphere(pointer); }
     public void setShowCelestialSphere(boolean showCelestialSphere) { c_setShowCelestialSphere(pointer, showCelestialSphere); }
+    @FastNative
     private static native void c_setShowCelestialSphere(long pointer, boolean showCelestialSphere);
+    @FastNative
     private native boolean c_getShowCelestialSphere(long pointer);
     public boolean getShowEclipticGrid() { return c_getShowEclipticGrid(pointer); }
     public void setShowEclipticGrid(boolean showEclipticGrid) { c_setShowEclipticGrid(pointer, showEclipticGrid); }
+    @FastNative
     private static native void c_setShowEclipticGrid(long pointer, boolean showEclipticGrid);
+    @FastNative
     private native boolean c_getShowEclipticGrid(long pointer);
     public boolean getShowHorizonGrid() { return c_getShowHorizonGrid(pointer); }
     public void setShowHorizonGrid(boolean showHorizonGrid) { c_setShowHorizonGrid(pointer, showHorizonGrid); }
+    @FastNative
     private static native void c_setShowHorizonGrid(long pointer, boolean showHorizonGrid);
+    @FastNative
     private native boolean c_getShowHorizonGrid(long pointer);
     public boolean getShowGalacticGrid() { return c_getShowGalacticGrid(pointer); }
     public void setShowGalacticGrid(boolean showGalacticGrid) { c_setShowGalacticGrid(pointer, showGalacticGrid); }
+    @FastNative
     private static native void c_setShowGalacticGrid(long pointer, boolean showGalacticGrid);
+    @FastNative
     private native boolean c_getShowGalacticGrid(long pointer);
     public boolean getShowEcliptic() { return c_getShowEcliptic(pointer); }
     public void setShowEcliptic(boolean showEcliptic) { c_setShowEcliptic(pointer, showEcliptic); }
+    @FastNative
     private static native void c_setShowEcliptic(long pointer, boolean showEcliptic);
+    @FastNative
     private native boolean c_getShowEcliptic(long pointer);
 
     public boolean getShowStarLabels() { return c_getShowStarLabels(pointer); }
     public void setShowStarLabels(boolean showStarLabels) { c_setShowStarLabels(pointer, showStarLabels); }
+    @FastNative
     private static native void c_setShowStarLabels(long pointer, boolean showStarLabels);
+    @FastNative
     private native boolean c_getShowStarLabels(long pointer);
     public boolean getShowPlanetLabels() { return c_getShowPlanetLabels(pointer); }
     public void setShowPlanetLabels(boolean showPlanetLabels) { c_setShowPlanetLabels(pointer, showPlanetLabels); }
+    @FastNative
     private static native void c_setShowPlanetLabels(long pointer, boolean showPlanetLabels);
+    @FastNative
     private native boolean c_getShowPlanetLabels(long pointer);
     public boolean getShowMoonLabels() { return c_getShowMoonLabels(pointer); }
     public void setShowMoonLabels(boolean showMoonLabels) { c_setShowMoonLabels(pointer, showMoonLabels); }
+    @FastNative
     private static native void c_setShowMoonLabels(long pointer, boolean showMoonLabels);
+    @FastNative
     private native boolean c_getShowMoonLabels(long pointer);
     public boolean getShowConstellationLabels() { return c_getShowConstellationLabels(pointer); }
     public void setShowConstellationLabels(boolean showConstellationLabels) { c_setShowConstellationLabels(pointer, showConstellationLabels); }
+    @FastNative
     private static native void c_setShowConstellationLabels(long pointer, boolean showConstellationLabels);
+    @FastNative
     private native boolean c_getShowConstellationLabels(long pointer);
     public boolean getShowGalaxyLabels() { return c_getShowGalaxyLabels(pointer); }
     public void setShowGalaxyLabels(boolean showGalaxyLabels) { c_setShowGalaxyLabels(pointer, showGalaxyLabels); }
+    @FastNative
     private static native void c_setShowGalaxyLabels(long pointer, boolean showGalaxyLabels);
+    @FastNative
     private native boolean c_getShowGalaxyLabels(long pointer);
     public boolean getShowGlobularLabels() { return c_getShowGlobularLabels(pointer); }
     public void setShowGlobularLabels(boolean showGlobularLabels) { c_setShowGlobularLabels(pointer, showGlobularLabels); }
+    @FastNative
     private static native void c_setShowGlobularLabels(long pointer, boolean showGlobularLabels);
+    @FastNative
     private native boolean c_getShowGlobularLabels(long pointer);
     public boolean getShowNebulaLabels() { return c_getShowNebulaLabels(pointer); }
     public void setShowNebulaLabels(boolean showNebulaLabels) { c_setShowNebulaLabels(pointer, showNebulaLabels); }
+    @FastNative
     private static native void c_setShowNebulaLabels(long pointer, boolean showNebulaLabels);
+    @FastNative
     private native boolean c_getShowNebulaLabels(long pointer);
     public boolean getShowOpenClusterLabels() { return c_getShowOpenClusterLabels(pointer); }
     public void setShowOpenClusterLabels(boolean showOpenClusterLabels) { c_setShowOpenClusterLabels(pointer, showOpenClusterLabels); }
+    @FastNative
     private static native void c_setShowOpenClusterLabels(long pointer, boolean showOpenClusterLabels);
+    @FastNative
     private native boolean c_getShowOpenClusterLabels(long pointer);
     public boolean getShowAsteroidLabels() { return c_getShowAsteroidLabels(pointer); }
     public void setShowAsteroidLabels(boolean showAsteroidLabels) { c_setShowAsteroidLabels(pointer, showAsteroidLabels); }
+    @FastNative
     private static native void c_setShowAsteroidLabels(long pointer, boolean showAsteroidLabels);
+    @FastNative
     private native boolean c_getShowAsteroidLabels(long pointer);
     public boolean getShowSpacecraftLabels() { return c_getShowSpacecraftLabels(pointer); }
     public void setShowSpacecraftLabels(boolean showSpacecraftLabels) { c_setShowSpacecraftLabels(pointer, showSpacecraftLabels); }
+    @FastNative
     private static native void c_setShowSpacecraftLabels(long pointer, boolean showSpacecraftLabels);
+    @FastNative
     private native boolean c_getShowSpacecraftLabels(long pointer);
     public boolean getShowLocationLabels() { return c_getShowLocationLabels(pointer); }
     public void setShowLocationLabels(boolean showLocationLabels) { c_setShowLocationLabels(pointer, showLocationLabels); }
+    @FastNative
     private static native void c_setShowLocationLabels(long pointer, boolean showLocationLabels);
+    @FastNative
     private native boolean c_getShowLocationLabels(long pointer);
     public boolean getShowCometLabels() { return c_getShowCometLabels(pointer); }
     public void setShowCometLabels(boolean showCometLabels) { c_setShowCometLabels(pointer, showCometLabels); }
+    @FastNative
     private static native void c_setShowCometLabels(long pointer, boolean showCometLabels);
+    @FastNative
     private native boolean c_getShowCometLabels(long pointer);
     public boolean getShowDwarfPlanetLabels() { return c_getShowDwarfPlanetLabels(pointer); }
     public void setShowDwarfPlanetLabels(boolean showDwarfPlanetLabels) { c_setShowDwarfPlanetLabels(pointer, showDwarfPlanetLabels); }
+    @FastNative
     private static native void c_setShowDwarfPlanetLabels(long pointer, boolean showDwarfPlanetLabels);
+    @FastNative
     private native boolean c_getShowDwarfPlanetLabels(long pointer);
     public boolean getShowMinorMoonLabels() { return c_getShowMinorMoonLabels(pointer); }
     public void setShowMinorMoonLabels(boolean showMinorMoonLabels) { c_setShowMinorMoonLabels(pointer, showMinorMoonLabels); }
+    @FastNative
     private static native void c_setShowMinorMoonLabels(long pointer, boolean showMinorMoonLabels);
+    @FastNative
     private native boolean c_getShowMinorMoonLabels(long pointer);
 
     // ShowLatinConstellationLabels (UI) is the opposite value of ShowI18nConstellationLabels
     public boolean getShowLatinConstellationLabels() { return !c_getShowI18nConstellationLabels(pointer); }
     public void setShowLatinConstellationLabels(boolean showLatinConstellationLabels) { c_setShowI18nConstellationLabels(pointer, !showLatinConstellationLabels); }
+    @FastNative
     private static native void c_setShowI18nConstellationLabels(long pointer, boolean showI18nConstellationLabels);
+    @FastNative
     private static native boolean c_getShowI18nConstellationLabels(long pointer);
 
     public boolean getShowPlanetOrbits() { return c_getShowPlanetOrbits(pointer); }
     public void setShowPlanetOrbits(boolean showPlanetOrbits) { c_setShowPlanetOrbits(pointer, showPlanetOrbits); }
+    @FastNative
     private static native void c_setShowPlanetOrbits(long pointer, boolean showPlanetOrbits);
+    @FastNative
     private native boolean c_getShowPlanetOrbits(long pointer);
     public boolean getShowMoonOrbits() { return c_getShowMoonOrbits(pointer); }
     public void setShowMoonOrbits(boolean showMoonOrbits) { c_setShowMoonOrbits(pointer, showMoonOrbits); }
+    @FastNative
     private static native void c_setShowMoonOrbits(long pointer, boolean showMoonOrbits);
+    @FastNative
     private native boolean c_getShowMoonOrbits(long pointer);
     public boolean getShowAsteroidOrbits() { return c_getShowAsteroidOrbits(pointer); }
     public void setShowAsteroidOrbits(boolean showAsteroidOrbits) { c_setShowAsteroidOrbits(pointer, showAsteroidOrbits); }
+    @FastNative
     private static native void c_setShowAsteroidOrbits(long pointer, boolean showAsteroidOrbits);
+    @FastNative
     private native boolean c_getShowAsteroidOrbits(long pointer);
     public boolean getShowSpacecraftOrbits() { return c_getShowSpacecraftOrbits(pointer); }
     public void setShowSpacecraftOrbits(boolean showSpacecraftOrbits) { c_setShowSpacecraftOrbits(pointer, showSpacecraftOrbits); }
+    @FastNative
     private static native void c_setShowSpacecraftOrbits(long pointer, boolean showSpacecraftOrbits);
+    @FastNative
     private native boolean c_getShowSpacecraftOrbits(long pointer);
     public boolean getShowCometOrbits() { return c_getShowCometOrbits(pointer); }
     public void setShowCometOrbits(boolean showCometOrbits) { c_setShowCometOrbits(pointer, showCometOrbits); }
+    @FastNative
     private static native void c_setShowCometOrbits(long pointer, boolean showCometOrbits);
+    @FastNative
     private native boolean c_getShowCometOrbits(long pointer);
     public boolean getShowStellarOrbits() { return c_getShowStellarOrbits(pointer); }
     public void setShowStellarOrbits(boolean showStellarOrbits) { c_setShowStellarOrbits(pointer, showStellarOrbits); }
+    @FastNative
     private static native void c_setShowStellarOrbits(long pointer, boolean showStellarOrbits);
+    @FastNative
     private native boolean c_getShowStellarOrbits(long pointer);
     public boolean getShowDwarfPlanetOrbits() { return c_getShowDwarfPlanetOrbits(pointer); }
     public void setShowDwarfPlanetOrbits(boolean showDwarfPlanetOrbits) { c_setShowDwarfPlanetOrbits(pointer, showDwarfPlanetOrbits); }
+    @FastNative
     private static native void c_setShowDwarfPlanetOrbits(long pointer, boolean showDwarfPlanetOrbits);
+    @FastNative
     private native boolean c_getShowDwarfPlanetOrbits(long pointer);
     public boolean getShowMinorMoonOrbits() { return c_getShowMinorMoonOrbits(pointer); }
     public void setShowMinorMoonOrbits(boolean showMinorMoonOrbits) { c_setShowMinorMoonOrbits(pointer, showMinorMoonOrbits); }
+    @FastNative
     private static native void c_setShowMinorMoonOrbits(long pointer, boolean showMinorMoonOrbits);
+    @FastNative
     private native boolean c_getShowMinorMoonOrbits(long pointer);
 
     public boolean getShowCityLabels() { return c_getShowCityLabels(pointer); }
     public void setShowCityLabels(boolean showCityLabels) { c_setShowCityLabels(pointer, showCityLabels); }
+    @FastNative
     private static native void c_setShowCityLabels(long pointer, boolean showCityLabels);
+    @FastNative
     private native boolean c_getShowCityLabels(long pointer);
     public boolean getShowObservatoryLabels() { return c_getShowObservatoryLabels(pointer); }
     public void setShowObservatoryLabels(boolean showObservatoryLabels) { c_setShowObservatoryLabels(pointer, showObservatoryLabels); }
+    @FastNative
     private static native void c_setShowObservatoryLabels(long pointer, boolean showObservatoryLabels);
+    @FastNative
     private native boolean c_getShowObservatoryLabels(long pointer);
     public boolean getShowLandingSiteLabels() { return c_getShowLandingSiteLabels(pointer); }
     public void setShowLandingSiteLabels(boolean showLandingSiteLabels) { c_setShowLandingSiteLabels(pointer, showLandingSiteLabels); }
+    @FastNative
     private static native void c_setShowLandingSiteLabels(long pointer, boolean showLandingSiteLabels);
+    @FastNative
     private native boolean c_getShowLandingSiteLabels(long pointer);
     public boolean getShowCraterLabels() { return c_getShowCraterLabels(pointer); }
     public void setShowCraterLabels(boolean showCraterLabels) { c_setShowCraterLabels(pointer, showCraterLabels); }
+    @FastNative
     private static native void c_setShowCraterLabels(long pointer, boolean showCraterLabels);
+    @FastNative
     private native boolean c_getShowCraterLabels(long pointer);
     public boolean getShowVallisLabels() { return c_getShowVallisLabels(pointer); }
     public void setShowVallisLabels(boolean showVallisLabels) { c_setShowVallisLabels(pointer, showVallisLabels); }
+    @FastNative
     private static native void c_setShowVallisLabels(long pointer, boolean showVallisLabels);
+    @FastNative
     private native boolean c_getShowVallisLabels(long pointer);
     public boolean getShowMonsLabels() { return c_getShowMonsLabels(pointer); }
     public void setShowMonsLabels(boolean showMonsLabels) { c_setShowMonsLabels(pointer, showMonsLabels); }
+    @FastNative
     private static native void c_setShowMonsLabels(long pointer, boolean showMonsLabels);
+    @FastNative
     private native boolean c_getShowMonsLabels(long pointer);
     public boolean getShowPlanumLabels() { return c_getShowPlanumLabels(pointer); }
     public void setShowPlanumLabels(boolean showPlanumLabels) { c_setShowPlanumLabels(pointer, showPlanumLabels); }
+    @FastNative
     private static native void c_setShowPlanumLabels(long pointer, boolean showPlanumLabels);
+    @FastNative
     private native boolean c_getShowPlanumLabels(long pointer);
     public boolean getShowChasmaLabels() { return c_getShowChasmaLabels(pointer); }
     public void setShowChasmaLabels(boolean showChasmaLabels) { c_setShowChasmaLabels(pointer, showChasmaLabels); }
+    @FastNative
     private static native void c_setShowChasmaLabels(long pointer, boolean showChasmaLabels);
+    @FastNative
     private native boolean c_getShowChasmaLabels(long pointer);
     public boolean getShowCollumLabels() { return c_getShowCollumLabels(pointer); }
     public void setShowCollumLabels(boolean showCollumLabels) { c_setShowCollumLabels(pointer, showCollumLabels); }
+    @FastNative
     private static native void c_setShowCollumLabels(long pointer, boolean showCollumLabels);
+    @FastNative
     private native boolean c_getShowCollumLabels(long pointer);
     public boolean getShowPateraLabels() { return c_getShowPateraLabels(pointer); }
     public void setShowPateraLabels(boolean showPateraLabels) { c_setShowPateraLabels(pointer, showPateraLabels); }
+    @FastNative
     private static native void c_setShowPateraLabels(long pointer, boolean showPateraLabels);
+    @FastNative
     private native boolean c_getShowPateraLabels(long pointer);
     public boolean getShowMareLabels() { return c_getShowMareLabels(pointer); }
     public void setShowMareLabels(boolean showMareLabels) { c_setShowMareLabels(pointer, showMareLabels); }
+    @FastNative
     private static native void c_setShowMareLabels(long pointer, boolean showMareLabels);
+    @FastNative
     private native boolean c_getShowMareLabels(long pointer);
     public boolean getShowRupesLabels() { return c_getShowRupesLabels(pointer); }
     public void setShowRupesLabels(boolean showRupesLabels) { c_setShowRupesLabels(pointer, showRupesLabels); }
+    @FastNative
     private static native void c_setShowRupesLabels(long pointer, boolean showRupesLabels);
+    @FastNative
     private native boolean c_getShowRupesLabels(long pointer);
     public boolean getShowTesseraLabels() { return c_getShowTesseraLabels(pointer); }
     public void setShowTesseraLabels(boolean showTesseraLabels) { c_setShowTesseraLabels(pointer, showTesseraLabels); }
+    @FastNative
     private static native void c_setShowTesseraLabels(long pointer, boolean showTesseraLabels);
+    @FastNative
     private native boolean c_getShowTesseraLabels(long pointer);
     public boolean getShowRegioLabels() { return c_getShowRegioLabels(pointer); }
     public void setShowRegioLabels(boolean showRegioLabels) { c_setShowRegioLabels(pointer, showRegioLabels); }
+    @FastNative
     private static native void c_setShowRegioLabels(long pointer, boolean showRegioLabels);
+    @FastNative
     private native boolean c_getShowRegioLabels(long pointer);
     public boolean getShowChaosLabels() { return c_getShowChaosLabels(pointer); }
     public void setShowChaosLabels(boolean showChaosLabels) { c_setShowChaosLabels(pointer, showChaosLabels); }
+    @FastNative
     private static native void c_setShowChaosLabels(long pointer, boolean showChaosLabels);
+    @FastNative
     private native boolean c_getShowChaosLabels(long pointer);
     public boolean getShowTerraLabels() { return c_getShowTerraLabels(pointer); }
     public void setShowTerraLabels(boolean showTerraLabels) { c_setShowTerraLabels(pointer, showTerraLabels); }
+    @FastNative
     private static native void c_setShowTerraLabels(long pointer, boolean showTerraLabels);
+    @FastNative
     private native boolean c_getShowTerraLabels(long pointer);
     public boolean getShowAstrumLabels() { return c_getShowAstrumLabels(pointer); }
     public void setShowAstrumLabels(boolean showAstrumLabels) { c_setShowAstrumLabels(pointer, showAstrumLabels); }
+    @FastNative
     private static native void c_setShowAstrumLabels(long pointer, boolean showAstrumLabels);
+    @FastNative
     private native boolean c_getShowAstrumLabels(long pointer);
     public boolean getShowCoronaLabels() { return c_getShowCoronaLabels(pointer); }
     public void setShowCoronaLabels(boolean showCoronaLabels) { c_setShowCoronaLabels(pointer, showCoronaLabels); }
+    @FastNative
     private static native void c_setShowCoronaLabels(long pointer, boolean showCoronaLabels);
+    @FastNative
     private native boolean c_getShowCoronaLabels(long pointer);
     public boolean getShowDorsumLabels() { return c_getShowDorsumLabels(pointer); }
     public void setShowDorsumLabels(boolean showDorsumLabels) { c_setShowDorsumLabels(pointer, showDorsumLabels); }
+    @FastNative
     private static native void c_setShowDorsumLabels(long pointer, boolean showDorsumLabels);
+    @FastNative
     private native boolean c_getShowDorsumLabels(long pointer);
     public boolean getShowFossaLabels() { return c_getShowFossaLabels(pointer); }
     public void setShowFossaLabels(boolean showFossaLabels) { c_setShowFossaLabels(pointer, showFossaLabels); }
+    @FastNative
     private static native void c_setShowFossaLabels(long pointer, boolean showFossaLabels);
+    @FastNative
     private native boolean c_getShowFossaLabels(long pointer);
     public boolean getShowCatenaLabels() { return c_getShowCatenaLabels(pointer); }
     public void setShowCatenaLabels(boolean showCatenaLabels) { c_setShowCatenaLabels(pointer, showCatenaLabels); }
+    @FastNative
     private static native void c_setShowCatenaLabels(long pointer, boolean showCatenaLabels);
+    @FastNative
     private native boolean c_getShowCatenaLabels(long pointer);
     public boolean getShowMensaLabels() { return c_getShowMensaLabels(pointer); }
     public void setShowMensaLabels(boolean showMensaLabels) { c_setShowMensaLabels(pointer, showMensaLabels); }
+    @FastNative
     private static native void c_setShowMensaLabels(long pointer, boolean showMensaLabels);
+    @FastNative
     private native boolean c_getShowMensaLabels(long pointer);
     public boolean getShowRimaLabels() { return c_getShowRimaLabels(pointer); }
     public void setShowRimaLabels(boolean showRimaLabels) { c_setShowRimaLabels(pointer, showRimaLabels); }
+    @FastNative
     private static native void c_setShowRimaLabels(long pointer, boolean showRimaLabels);
+    @FastNative
     private native boolean c_getShowRimaLabels(long pointer);
     public boolean getShowUndaeLabels() { return c_getShowUndaeLabels(pointer); }
     public void setShowUndaeLabels(boolean showUndaeLabels) { c_setShowUndaeLabels(pointer, showUndaeLabels); }
+    @FastNative
     private static native void c_setShowUndaeLabels(long pointer, boolean showUndaeLabels);
+    @FastNative
     private native boolean c_getShowUndaeLabels(long pointer);
     public boolean getShowReticulumLabels() { return c_getShowReticulumLabels(pointer); }
     public void setShowReticulumLabels(boolean showReticulumLabels) { c_setShowReticulumLabels(pointer, showReticulumLabels); }
+    @FastNative
     private static native void c_setShowReticulumLabels(long pointer, boolean showReticulumLabels);
+    @FastNative
     private native boolean c_getShowReticulumLabels(long pointer);
     public boolean getShowPlanitiaLabels() { return c_getShowPlanitiaLabels(pointer); }
     public void setShowPlanitiaLabels(boolean showPlanitiaLabels) { c_setShowPlanitiaLabels(pointer, showPlanitiaLabels); }
+    @FastNative
     private static native void c_setShowPlanitiaLabels(long pointer, boolean showPlanitiaLabels);
+    @FastNative
     private native boolean c_getShowPlanitiaLabels(long pointer);
     public boolean getShowLineaLabels() { return c_getShowLineaLabels(pointer); }
     public void setShowLineaLabels(boolean showLineaLabels) { c_setShowLineaLabels(pointer, showLineaLabels); }
+    @FastNative
     private static native void c_setShowLineaLabels(long pointer, boolean showLineaLabels);
+    @FastNative
     private native boolean c_getShowLineaLabels(long pointer);
     public boolean getShowFluctusLabels() { return c_getShowFluctusLabels(pointer); }
     public void setShowFluctusLabels(boolean showFluctusLabels) { c_setShowFluctusLabels(pointer, showFluctusLabels); }
+    @FastNative
     private static native void c_setShowFluctusLabels(long pointer, boolean showFluctusLabels);
+    @FastNative
     private native boolean c_getShowFluctusLabels(long pointer);
     public boolean getShowFarrumLabels() { return c_getShowFarrumLabels(pointer); }
     public void setShowFarrumLabels(boolean showFarrumLabels) { c_setShowFarrumLabels(pointer, showFarrumLabels); }
+    @FastNative
     private static native void c_setShowFarrumLabels(long pointer, boolean showFarrumLabels);
+    @FastNative
     private native boolean c_getShowFarrumLabels(long pointer);
     public boolean getShowEruptiveCenterLabels() { return c_getShowEruptiveCenterLabels(pointer); }
     public void setShowEruptiveCenterLabels(boolean showEruptiveCenterLabels) { c_setShowEruptiveCenterLabels(pointer, showEruptiveCenterLabels); }
+    @FastNative
     private static native void c_setShowEruptiveCenterLabels(long pointer, boolean showEruptiveCenterLabels);
+    @FastNative
     private native boolean c_getShowEruptiveCenterLabels(long pointer);
     public boolean getShowTholusLabels() { return c_getShowTholusLabels(pointer); }
     public void setShowTholusLabels(boolean showTholusLabels) { c_setShowTholusLabels(pointer, showTholusLabels); }
+    @FastNative
     private static native void c_setShowTholusLabels(long pointer, boolean showTholusLabels);
+    @FastNative
     private native boolean c_getShowTholusLabels(long pointer);
     public boolean getShowInsulaLabels() { return c_getShowInsulaLabels(pointer); }
     public void setShowInsulaLabels(boolean showInsulaLabels) { c_setShowInsulaLabels(pointer, showInsulaLabels); }
+    @FastNative
     private static native void c_setShowInsulaLabels(long pointer, boolean showInsulaLabels);
+    @FastNative
     private native boolean c_getShowInsulaLabels(long pointer);
     public boolean getShowAlbedoLabels() { return c_getShowAlbedoLabels(pointer); }
     public void setShowAlbedoLabels(boolean showAlbedoLabels) { c_setShowAlbedoLabels(pointer, showAlbedoLabels); }
+    @FastNative
     private static native void c_setShowAlbedoLabels(long pointer, boolean showAlbedoLabels);
+    @FastNative
     private native boolean c_getShowAlbedoLabels(long pointer);
     public boolean getShowArcusLabels() { return c_getShowArcusLabels(pointer); }
     public void setShowArcusLabels(boolean showArcusLabels) { c_setShowArcusLabels(pointer, showArcusLabels); }
+    @FastNative
     private static native void c_setShowArcusLabels(long pointer, boolean showArcusLabels);
+    @FastNative
     private native boolean c_getShowArcusLabels(long pointer);
     public boolean getShowCavusLabels() { return c_getShowCavusLabels(pointer); }
     public void setShowCavusLabels(boolean showCavusLabels) { c_setShowCavusLabels(pointer, showCavusLabels); }
+    @FastNative
     private static native void c_setShowCavusLabels(long pointer, boolean showCavusLabels);
+    @FastNative
     private native boolean c_getShowCavusLabels(long pointer);
     public boolean getShowCollesLabels() { return c_getShowCollesLabels(pointer); }
     public void setShowCollesLabels(boolean showCollesLabels) { c_setShowCollesLabels(pointer, showCollesLabels); }
+    @FastNative
     private static native void c_setShowCollesLabels(long pointer, boolean showCollesLabels);
+    @FastNative
     private native boolean c_getShowCollesLabels(long pointer);
     public boolean getShowFaculaLabels() { return c_getShowFaculaLabels(pointer); }
     public void setShowFaculaLabels(boolean showFaculaLabels) { c_setShowFaculaLabels(pointer, showFaculaLabels); }
+    @FastNative
     private static native void c_setShowFaculaLabels(long pointer, boolean showFaculaLabels);
+    @FastNative
     private native boolean c_getShowFaculaLabels(long pointer);
     public boolean getShowFlexusLabels() { return c_getShowFlexusLabels(pointer); }
     public void setShowFlexusLabels(boolean showFlexusLabels) { c_setShowFlexusLabels(pointer, showFlexusLabels); }
+    @FastNative
     private static native void c_setShowFlexusLabels(long pointer, boolean showFlexusLabels);
+    @FastNative
     private native boolean c_getShowFlexusLabels(long pointer);
     public boolean getShowFlumenLabels() { return c_getShowFlumenLabels(pointer); }
     public void setShowFlumenLabels(boolean showFlumenLabels) { c_setShowFlumenLabels(pointer, showFlumenLabels); }
+    @FastNative
     private static native void c_setShowFlumenLabels(long pointer, boolean showFlumenLabels);
+    @FastNative
     private native boolean c_getShowFlumenLabels(long pointer);
     public boolean getShowFretumLabels() { return c_getShowFretumLabels(pointer); }
     public void setShowFretumLabels(boolean showFretumLabels) { c_setShowFretumLabels(pointer, showFretumLabels); }
+    @FastNative
     private static native void c_setShowFretumLabels(long pointer, boolean showFretumLabels);
+    @FastNative
     private native boolean c_getShowFretumLabels(long pointer);
     public boolean getShowLabesLabels() { return c_getShowLabesLabels(pointer); }
     public void setShowLabesLabels(boolean showLabesLabels) { c_setShowLabesLabels(pointer, showLabesLabels); }
+    @FastNative
     private static native void c_setShowLabesLabels(long pointer, boolean showLabesLabels);
+    @FastNative
     private native boolean c_getShowLabesLabels(long pointer);
     public boolean getShowLabyrinthusLabels() { return c_getShowLabyrinthusLabels(pointer); }
     public void setShowLabyrinthusLabels(boolean showLabyrinthusLabels) { c_setShowLabyrinthusLabels(pointer, showLabyrinthusLabels); }
+    @FastNative
     private static native void c_setShowLabyrinthusLabels(long pointer, boolean showLabyrinthusLabels);
+    @FastNative
     private native boolean c_getShowLabyrinthusLabels(long pointer);
     public boolean getShowLacunaLabels() { return c_getShowLacunaLabels(pointer); }
     public void setShowLacunaLabels(boolean showLacunaLabels) { c_setShowLacunaLabels(pointer, showLacunaLabels); }
+    @FastNative
     private static native void c_setShowLacunaLabels(long pointer, boolean showLacunaLabels);
+    @FastNative
     private native boolean c_getShowLacunaLabels(long pointer);
     public boolean getShowLacusLabels() { return c_getShowLacusLabels(pointer); }
     public void setShowLacusLabels(boolean showLacusLabels) { c_setShowLacusLabels(pointer, showLacusLabels); }
+    @FastNative
     private static native void c_setShowLacusLabels(long pointer, boolean showLacusLabels);
+    @FastNative
     private native boolean c_getShowLacusLabels(long pointer);
     public boolean getShowLargeRingedLabels() { return c_getShowLargeRingedLabels(pointer); }
     public void setShowLargeRingedLabels(boolean showLargeRingedLabels) { c_setShowLargeRingedLabels(pointer, showLargeRingedLabels); }
+    @FastNative
     private static native void c_setShowLargeRingedLabels(long pointer, boolean showLargeRingedLabels);
+    @FastNative
     private native boolean c_getShowLargeRingedLabels(long pointer);
     public boolean getShowLobusLabels() { return c_getShowLobusLabels(pointer); }
     public void setShowLobusLabels(boolean showLobusLabels) { c_setShowLobusLabels(pointer, showLobusLabels); }
+    @FastNative
     private static native void c_setShowLobusLabels(long pointer, boolean showLobusLabels);
+    @FastNative
     private native boolean c_getShowLobusLabels(long pointer);
     public boolean getShowLingulaLabels() { return c_getShowLingulaLabels(pointer); }
     public void setShowLingulaLabels(boolean showLingulaLabels) { c_setShowLingulaLabels(pointer, showLingulaLabels); }
+    @FastNative
     private static native void c_setShowLingulaLabels(long pointer, boolean showLingulaLabels);
+    @FastNative
     private native boolean c_getShowLingulaLabels(long pointer);
     public boolean getShowMaculaLabels() { return c_getShowMaculaLabels(pointer); }
     public void setShowMaculaLabels(boolean showMaculaLabels) { c_setShowMaculaLabels(pointer, showMaculaLabels); }
+    @FastNative
     private static native void c_setShowMaculaLabels(long pointer, boolean showMaculaLabels);
+    @FastNative
     private native boolean c_getShowMaculaLabels(long pointer);
     public boolean getShowOceanusLabels() { return c_getShowOceanusLabels(pointer); }
     public void setShowOceanusLabels(boolean showOceanusLabels) { c_setShowOceanusLabels(pointer, showOceanusLabels); }
+    @FastNative
     private static native void c_setShowOceanusLabels(long pointer, boolean showOceanusLabels);
+    @FastNative
     private native boolean c_getShowOceanusLabels(long pointer);
     public boolean getShowPalusLabels() { return c_getShowPalusLabels(pointer); }
     public void setShowPalusLabels(boolean showPalusLabels) { c_setShowPalusLabels(pointer, showPalusLabels); }
+    @FastNative
     private static native void c_setShowPalusLabels(long pointer, boolean showPalusLabels);
+    @FastNative
     private native boolean c_getShowPalusLabels(long pointer);
     public boolean getShowPlumeLabels() { return c_getShowPlumeLabels(pointer); }
     public void setShowPlumeLabels(boolean showPlumeLabels) { c_setShowPlumeLabels(pointer, showPlumeLabels); }
+    @FastNative
     private static native void c_setShowPlumeLabels(long pointer, boolean showPlumeLabels);
+    @FastNative
     private native boolean c_getShowPlumeLabels(long pointer);
     public boolean getShowPromontoriumLabels() { return c_getShowPromontoriumLabels(pointer); }
     public void setShowPromontoriumLabels(boolean showPromontoriumLabels) { c_setShowPromontoriumLabels(pointer, showPromontoriumLabels); }
+    @FastNative
     private static native void c_setShowPromontoriumLabels(long pointer, boolean showPromontoriumLabels);
+    @FastNative
     private native boolean c_getShowPromontoriumLabels(long pointer);
     public boolean getShowSatelliteLabels() { return c_getShowSatelliteLabels(pointer); }
     public void setShowSatelliteLabels(boolean showSatelliteLabels) { c_setShowSatelliteLabels(pointer, showSatelliteLabels); }
+    @FastNative
     private static native void c_setShowSatelliteLabels(long pointer, boolean showSatelliteLabels);
+    @FastNative
     private native boolean c_getShowSatelliteLabels(long pointer);
     public boolean getShowScopulusLabels() { return c_getShowScopulusLabels(pointer); }
     public void setShowScopulusLabels(boolean showScopulusLabels) { c_setShowScopulusLabels(pointer, showScopulusLabels); }
+    @FastNative
     private static native void c_setShowScopulusLabels(long pointer, boolean showScopulusLabels);
+    @FastNative
     private native boolean c_getShowScopulusLabels(long pointer);
     public boolean getShowSerpensLabels() { return c_getShowSerpensLabels(pointer); }
     public void setShowSerpensLabels(boolean showSerpensLabels) { c_setShowSerpensLabels(pointer, showSerpensLabels); }
+    @FastNative
     private static native void c_setShowSerpensLabels(long pointer, boolean showSerpensLabels);
+    @FastNative
     private native boolean c_getShowSerpensLabels(long pointer);
     public boolean getShowSinusLabels() { return c_getShowSinusLabels(pointer); }
     public void setShowSinusLabels(boolean showSinusLabels) { c_setShowSinusLabels(pointer, showSinusLabels); }
+    @FastNative
     private static native void c_setShowSinusLabels(long pointer, boolean showSinusLabels);
+    @FastNative
     private native boolean c_getShowSinusLabels(long pointer);
     public boolean getShowSulcusLabels() { return c_getShowSulcusLabels(pointer); }
     public void setShowSulcusLabels(boolean showSulcusLabels) { c_setShowSulcusLabels(pointer, showSulcusLabels); }
+    @FastNative
     private static native void c_setShowSulcusLabels(long pointer, boolean showSulcusLabels);
+    @FastNative
     private native boolean c_getShowSulcusLabels(long pointer);
     public boolean getShowVastitasLabels() { return c_getShowVastitasLabels(pointer); }
     public void setShowVastitasLabels(boolean showVastitasLabels) { c_setShowVastitasLabels(pointer, showVastitasLabels); }
+    @FastNative
     private static native void c_setShowVastitasLabels(long pointer, boolean showVastitasLabels);
+    @FastNative
     private native boolean c_getShowVastitasLabels(long pointer);
     public boolean getShowVirgaLabels() { return c_getShowVirgaLabels(pointer); }
     public void setShowVirgaLabels(boolean showVirgaLabels) { c_setShowVirgaLabels(pointer, showVirgaLabels); }
+    @FastNative
     private static native void c_setShowVirgaLabels(long pointer, boolean showVirgaLabels);
+    @FastNative
     private native boolean c_getShowVirgaLabels(long pointer);
     public boolean getShowSaxumLabels() { return c_getShowSaxumLabels(pointer); }
     public void setShowSaxumLabels(boolean showSaxumLabels) { c_setShowSaxumLabels(pointer, showSaxumLabels); }
+    @FastNative
     private static native void c_setShowSaxumLabels(long pointer, boolean showSaxumLabels);
+    @FastNative
     private native boolean c_getShowSaxumLabels(long pointer);
     public boolean getShowCosmodromeLabels() { return c_getShowCosmodromeLabels(pointer); }
     public void setShowCosmodromeLabels(boolean showCosmodromeLabels) { c_setShowCosmodromeLabels(pointer, showCosmodromeLabels); }
+    @FastNative
     private static native void c_setShowCosmodromeLabels(long pointer, boolean showCosmodromeLabels);
+    @FastNative
     private native boolean c_getShowCosmodromeLabels(long pointer);
     public boolean getShowRingLabels() { return c_getShowRingLabels(pointer); }
     public void setShowRingLabels(boolean showRingLabels) { c_setShowRingLabels(pointer, showRingLabels); }
+    @FastNative
     private static native void c_setShowRingLabels(long pointer, boolean showRingLabels);
+    @FastNative
     private native boolean c_getShowRingLabels(long pointer);
     public boolean getShowOtherLabels() { return c_getShowOtherLabels(pointer); }
     public void setShowOtherLabels(boolean showOtherLabels) { c_setShowOtherLabels(pointer, showOtherLabels); }
+    @FastNative
     private static native void c_setShowOtherLabels(long pointer, boolean showOtherLabels);
+    @FastNative
     private native boolean c_getShowOtherLabels(long pointer);
 
     public void setResolution(int resolution) { c_setResolution(pointer, resolution); }
@@ -1031,22 +1305,30 @@ public class AppCore {
 
     public boolean getEnableRayBasedDragging() { return c_getEnableRayBasedDragging(pointer); }
     public void setEnableRayBasedDragging(boolean value) { c_setEnableRayBasedDragging(pointer, value); }
+    @FastNative
     private static native void c_setEnableRayBasedDragging(long pointer, boolean value);
+    @FastNative
     private native boolean c_getEnableRayBasedDragging(long pointer);
 
     public boolean getEnableFocusZooming() { return c_getEnableFocusZooming(pointer); }
     public void setEnableFocusZooming(boolean value) { c_setEnableFocusZooming(pointer, value); }
+    @FastNative
     private static native void c_setEnableFocusZooming(long pointer, boolean value);
+    @FastNative
     private native boolean c_getEnableFocusZooming(long pointer);
 
     public boolean getEnableReverseWheel() { return c_getEnableReverseWheel(pointer); }
     public void setEnableReverseWheel(boolean value) { c_setEnableReverseWheel(pointer, value); }
+    @FastNative
     private static native void c_setEnableReverseWheel(long pointer, boolean value);
+    @FastNative
     private native boolean c_getEnableReverseWheel(long pointer);
 
     public boolean getEnableAlignCameraToSurfaceOnLand() { return c_getEnableAlignCameraToSurfaceOnLand(pointer); }
     public void setEnableAlignCameraToSurfaceOnLand(boolean value) { c_setEnableAlignCameraToSurfaceOnLand(pointer, value); }
+    @FastNative
     private static native void c_setEnableAlignCameraToSurfaceOnLand(long pointer, boolean value);
+    @FastNative
     private native boolean c_getEnableAlignCameraToSurfaceOnLand(long pointer);
 
 }
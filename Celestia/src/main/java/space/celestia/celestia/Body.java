@@ -9,6 +9,8 @@
 
 package space.celestia.celestia;
 
+import dalvik.annotation.optimization.FastNative;
+
 import androidx.annotation.NonNull;
 import androidx.annotation.Nullable;
 
@@ -87,19 +89,29 @@ public class Body extends AstroObject {
     }
 
     // C functions
+    @FastNative
     private static native int c_getType(long pointer);
     private static native String c_getName(long pointer);
+    @FastNative
     private static native boolean c_hasRings(long pointer);
+    @FastNative
     private static native boolean c_hasAtmosphere(long pointer);
+    @FastNative
     private static native boolean c_isEllipsoid(long pointer);
+    @FastNative
     private static native float c_getRadius(long pointer);
+    @FastNative
     private static native long c_getOrbitAtTime(long pointer, double julianDay);
+    @FastNative
     private static native long c_getRotationModelAtTime(long pointer, double julianDay);
+    @FastNative
     private static native long c_getPlanetarySystem(long pointer);
     private static native List<String> c_getAlternateSurfaceNames(long pointer);
 
+    @FastNative
     private static native long c_getTimeline(long pointer);
     private static native String c_getPath(long pointer, long starCatalogPointer);
 
+    @FastNative
     private static native boolean c_canBeUsedAsCockpit(long pointer);
 }
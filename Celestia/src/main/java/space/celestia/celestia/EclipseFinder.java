@@ -11,9 +11,6 @@ package space.celestia.celestia;
 
 import androidx.annotation.NonNull;
 
-import org.json.JSONArray;
-import org.json.JSONObject;
-
 import java.util.ArrayList;
 import java.util.List;
 
@@ -38,24 +35,48 @@ public class EclipseFinder implements AutoCloseable {
         }
     }
 
+    public interface ResultHandler {
+        /**
+         * Called on the searching thread with each batch of newly found eclipses.
+         * @return false to stop the search early
+         */
+        boolean onEclipsesFound(@NonNull List<Eclipse> eclipses);
+    }
+
+    private static class BatchReceiver {
+        private final ResultHandler handler;
+
+        private BatchReceiver(ResultHandler handler) {
+            this.handler = handler;
+        }
+
+        // Called from native code, bodies and times are packed in pairs per eclipse
+        private boolean onBatch(long[] bodies, double[] times) {
+            int count = times.length / 2;
+            ArrayList<Eclipse> eclipses = new ArrayList<>(count);
+            for (int i = 0; i < count; i++)
+                eclipses.add(new Eclipse(bodies[i * 2], bodies[i * 2 + 1], times[i * 2], times[i * 2 + 1]));
+            return handler.onEclipsesFound(eclipses);
+        }
+    }
+
     public EclipseFinder(Body body) {
         pointer = c_createWithBody(body.pointer);
     }
 
     public @NonNull List<Eclipse> search(double startTime, double endTime, int kind) {
-        String json = c_search(pointer, kind, startTime, endTime);
         ArrayList<Eclipse> eclipses = new ArrayList<>();
-        try {
-            JSONArray array = new JSONArray(json);
-            for (int i = 0; i < array.length(); i++) {
-                JSONObject j = array.getJSONObject(i);
-                Eclipse eclipse = new Eclipse(j.getLong("occulter"), j.getLong("receiver"), j.getDouble("startTime"), j.getDouble("endTime"));
-                eclipses.add(eclipse);
-            }
-        } catch (Exception ignored) {}
+        search(startTime, endTime, kind, batch -> {
+            eclipses.addAll(batch);
+            return true;
+        });
         return eclipses;
     }
 
+    public void search(double startTime, double endTime, int kind, @NonNull ResultHandler handler) {
+        c_search(pointer, kind, startTime, endTime, new BatchReceiver(handler));
+    }
+
     @Override
     public void close() throws Exception {
         if (!closed) {
@@ -71,5 +92,5 @@ public class EclipseFinder implements AutoCloseable {
     private static native long c_createWithBody(long ptr);
     private static native void c_destroy(long ptr);
     private static native void c_abort(long ptr);
-    private static native String c_search(long ptr, int kind, double startTimeJulian, double endTimeJulian);
+    private static native void c_search(long ptr, int kind, double startTimeJulian, double endTimeJulian, BatchReceiver receiver);
 }
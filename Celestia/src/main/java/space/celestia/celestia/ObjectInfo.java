@@ -0,0 +1,85 @@
+// ObjectInfo.java
+//
+// Copyright (C) 2025, Celestia Development Team
+//
+// This program is free software; you can redistribute it and/or
+// modify it under the terms of the GNU General Public License
+// as published by the Free Software Foundation; either version 2
+// of the License, or (at your option) any later version.
+
+package space.celestia.celestia;
+
+import androidx.annotation.NonNull;
+import androidx.annotation.Nullable;
+
+/**
+ * Summary of a selection gathered natively in one call, see
+ * {@link Universe#getObjectInfo(Selection, double)}. Values that do not
+ * apply to the selection type are zero or null.
+ */
+public final class ObjectInfo {
+    // Must match the record layout in CelestiaObjectInfo.cpp
+    static final int INT_COUNT = 2;
+    static final int DOUBLE_COUNT = 8;
+    static final int STRING_COUNT = 2;
+
+    private static final int FLAG_HAS_RINGS             = 1 << 0;
+    private static final int FLAG_HAS_ATMOSPHERE        = 1 << 1;
+    private static final int FLAG_ELLIPSOID             = 1 << 2;
+    private static final int FLAG_PERIODIC_ORBIT        = 1 << 3;
+    private static final int FLAG_PERIODIC_ROTATION     = 1 << 4;
+    private static final int FLAG_HAS_TIMELINE          = 1 << 5;
+
+    public final @NonNull Selection selection;
+    public final @NonNull String name;
+    // Spectral type for stars, description for deep sky objects
+    public final @Nullable String detail;
+    // Body type for bodies, object type for deep sky objects
+    public final int subtype;
+    // km for bodies, stars and locations, light years for deep sky objects
+    public final double radius;
+    // Days, 0 when not periodic
+    public final double orbitalPeriod;
+    public final double rotationPeriod;
+    // Start of the first and end of the last timeline phase
+    public final double startTime;
+    public final double endTime;
+    // Same units as Star.getPositionAtTime offset from zero and DSO.getPosition,
+    // body-fixed position for locations
+    public final double x;
+    public final double y;
+    public final double z;
+
+    private final int flags;
+
+    ObjectInfo(@NonNull Selection selection, int index, @NonNull int[] ints, @NonNull double[] doubles, @NonNull String[] strings) {
+        this.selection = selection;
+        int intBase = index * INT_COUNT;
+        int doubleBase = index * DOUBLE_COUNT;
+        int stringBase = index * STRING_COUNT;
+        flags = ints[intBase];
+        subtype = ints[intBase + 1];
+        radius = doubles[doubleBase];
+        orbitalPeriod = doubles[doubleBase + 1];
+        rotationPeriod = doubles[doubleBase + 2];
+        startTime = doubles[doubleBase + 3];
+        endTime = doubles[doubleBase + 4];
+        x = doubles[doubleBase + 5];
+        y = doubles[doubleBase + 6];
+        z = doubles[doubleBase + 7];
+        String objectName = strings[stringBase];
+        name = objectName == null ? "" : objectName;
+        detail = strings[stringBase + 1];
+    }
+
+    public boolean hasRings() { return (flags & FLAG_HAS_RINGS) != 0; }
+    public boolean hasAtmosphere() { return (flags & FLAG_HAS_ATMOSPHERE) != 0; }
+    public boolean isEllipsoid() { return (flags & FLAG_ELLIPSOID) != 0; }
+    public boolean isOrbitPeriodic() { return (flags & FLAG_PERIODIC_ORBIT) != 0; }
+    public boolean isRotationPeriodic() { return (flags & FLAG_PERIODIC_ROTATION) != 0; }
+    public boolean hasTimeline() { return (flags & FLAG_HAS_TIMELINE) != 0; }
+
+    public @NonNull Vector getPosition() {
+        return new Vector(x, y, z);
+    }
+}
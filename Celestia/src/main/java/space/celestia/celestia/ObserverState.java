@@ -0,0 +1,137 @@
+// ObserverState.java
+//
+// Copyright (C) 2025, Celestia Development Team
+//
+// This program is free software; you can redistribute it and/or
+// modify it under the terms of the GNU General Public License
+// as published by the Free Software Foundation; either version 2
+// of the License, or (at your option) any later version.
+
+package space.celestia.celestia;
+
+import android.os.Build;
+
+import androidx.annotation.NonNull;
+
+import java.lang.invoke.VarHandle;
+import java.nio.ByteBuffer;
+import java.nio.ByteOrder;
+import java.util.concurrent.locks.ReentrantReadWriteLock;
+
+/**
+ * Observer state the render thread publishes once per frame into shared
+ * memory, readable from any thread without a JNI call. Reads are protected
+ * by a sequence counter, so a snapshot never mixes values from two frames.
+ */
+public final class ObserverState {
+    // Must match ObserverStateBlock in CelestiaObserverState.h
+    private static final int SEQUENCE_OFFSET = 0;
+    private static final int PUBLISHED_OFFSET = 4;
+    private static final int POSITION_OFFSET = 8;
+    private static final int ORIENTATION_OFFSET = 56;
+    private static final int TIME_OFFSET = 88;
+    private static final int TIME_SCALE_OFFSET = 96;
+    private static final int SELECTION_POINTER_OFFSET = 104;
+    private static final int SELECTION_TYPE_OFFSET = 112;
+    private static final int SELECTION_IS_GALAXY_OFFSET = 116;
+    private static final int FOV_OFFSET = 120;
+    private static final int FRAME_OFFSET = 128;
+    private static final int BLOCK_SIZE = 136;
+
+    private static final int MAX_OPTIMISTIC_READS = 4;
+
+    public static final class Snapshot {
+        final long[] position = new long[UniversalCoord.PACKED_LENGTH];
+        // w, x, y, z
+        public final double[] orientation = new double[4];
+        public double julianDay;
+        public double timeScale;
+        public long selectionPointer;
+        public int selectionType;
+        public boolean selectionIsGalaxy;
+        // Vertical field of view in radians
+        public double fieldOfView;
+        public long frame;
+
+        public @NonNull UniversalCoord getPosition() {
+            return new UniversalCoord(position.clone());
+        }
+
+        public @NonNull Selection getSelection() {
+            return new Selection(selectionPointer, selectionType, selectionIsGalaxy);
+        }
+    }
+
+    private final long feedPointer;
+    private final ByteBuffer shared;
+    private final ByteBuffer scratch = ByteBuffer.allocateDirect(BLOCK_SIZE).order(ByteOrder.nativeOrder());
+    // Readers hold the read lock so the block cannot be freed under them
+    private final ReentrantReadWriteLock lifetimeLock = new ReentrantReadWriteLock();
+    private boolean detached = false;
+
+    ObserverState(long feedPointer, @NonNull ByteBuffer shared) {
+        this.feedPointer = feedPointer;
+        this.shared = shared.order(ByteOrder.nativeOrder());
+    }
+
+    /**
+     * Fills {@code snapshot} with the state of the last frame drawn.
+     * @return false if no frame has been drawn yet, the renderer is closed or
+     * the render thread stalled in the middle of publishing
+     */
+    public boolean read(@NonNull Snapshot snapshot) {
+        lifetimeLock.readLock().lock();
+        try {
+            if (detached) return false;
+            return readAttached(snapshot);
+        } finally {
+            lifetimeLock.readLock().unlock();
+        }
+    }
+
+    /**
+     * Stops reads before the native block is freed. Waits for reads in flight.
+     */
+    void detach() {
+        lifetimeLock.writeLock().lock();
+        detached = true;
+        lifetimeLock.writeLock().unlock();
+    }
+
+    private boolean readAttached(@NonNull Snapshot snapshot) {
+        // Fences to order plain buffer reads are only public from API 33
+        if (Build.VERSION.SDK_INT >= Build.VERSION_CODES.TIRAMISU) {
+            for (int attempt = 0; attempt < MAX_OPTIMISTIC_READS; attempt++) {
+                int sequence = shared.getInt(SEQUENCE_OFFSET);
+                if ((sequence & 1) != 0) continue;
+                VarHandle.acquireFence();
+                boolean published = readBlock(shared, snapshot);
+                VarHandle.loadLoadFence();
+                if (shared.getInt(SEQUENCE_OFFSET) == sequence)
+                    return published;
+            }
+        }
+        // Let native copy the block under the same protocol
+        synchronized (scratch) {
+            if (!c_copy(feedPointer, scratch)) return false;
+            return readBlock(scratch, snapshot);
+        }
+    }
+
+    private static boolean readBlock(@NonNull ByteBuffer buffer, @NonNull Snapshot snapshot) {
+        for (int i = 0; i < UniversalCoord.PACKED_LENGTH; i++)
+            snapshot.position[i] = buffer.getLong(POSITION_OFFSET + i * 8);
+        for (int i = 0; i < 4; i++)
+            snapshot.orientation[i] = buffer.getDouble(ORIENTATION_OFFSET + i * 8);
+        snapshot.julianDay = buffer.getDouble(TIME_OFFSET);
+        snapshot.timeScale = buffer.getDouble(TIME_SCALE_OFFSET);
+        snapshot.selectionPointer = buffer.getLong(SELECTION_POINTER_OFFSET);
+        snapshot.selectionType = buffer.getInt(SELECTION_TYPE_OFFSET);
+        snapshot.selectionIsGalaxy = buffer.getInt(SELECTION_IS_GALAXY_OFFSET) != 0;
+        snapshot.fieldOfView = buffer.getDouble(FOV_OFFSET);
+        snapshot.frame = buffer.getLong(FRAME_OFFSET);
+        return buffer.getInt(PUBLISHED_OFFSET) != 0;
+    }
+
+    private static native boolean c_copy(long pointer, ByteBuffer buffer);
+}
@@ -9,6 +9,8 @@
 
 package space.celestia.celestia;
 
+import dalvik.annotation.optimization.FastNative;
+
 public class Orbit {
     protected long pointer;
 
@@ -25,10 +27,15 @@ public class Orbit {
     public Vector getVelocityAtTime(double julianDay) { return c_getVelocityAtTime(pointer, julianDay); }
     public Vector getPositionAtTime(double julianDay) { return c_getPositionAtTime(pointer, julianDay); }
 
+    @FastNative
     private static native boolean c_isPeriodic(long pointer);
+    @FastNative
     private static native double c_getPeriod(long pointer);
+    @FastNative
     private static native double c_getBoundingRadius(long pointer);
+    @FastNative
     private static native double c_getValidBeginTime(long pointer);
+    @FastNative
     private static native double c_getValidEndTime(long pointer);
 
     private static native Vector c_getVelocityAtTime(long pointer, double julianDay);
@@ -0,0 +1,126 @@
+// RenderSettings.java
+//
+// Copyright (C) 2025, Celestia Development Team
+//
+// This program is free software; you can redistribute it and/or
+// modify it under the terms of the GNU General Public License
+// as published by the Free Software Foundation; either version 2
+// of the License, or (at your option) any later version.
+
+package space.celestia.celestia;
+
+import androidx.annotation.NonNull;
+
+import java.util.BitSet;
+import java.util.HashMap;
+import java.util.Map;
+
+/**
+ * Snapshot of the render flags and scalar render settings exposed by
+ * {@link AppCore}, read with {@link AppCore#getRenderSettings()} in a
+ * single native call. Changes made through the setters are recorded and
+ * only the changed entries are written back by
+ * {@link AppCore#applyRenderSettings(RenderSettings)}.
+ * <p>
+ * Keys match the names of the corresponding {@link AppCore} accessors,
+ * e.g. "ShowStars" or "StarStyle".
+ */
+public final class RenderSettings {
+    // ShowLatinConstellationLabels (UI) is the opposite value of ShowI18nConstellationLabels
+    private static final String LATIN_CONSTELLATION_LABELS_KEY = "ShowLatinConstellationLabels";
+    private static final String I18N_CONSTELLATION_LABELS_KEY = "ShowI18nConstellationLabels";
+
+    private static final Map<String, Integer> booleanIndices = indexKeys(c_getBooleanKeys());
+    private static final Map<String, Integer> intIndices = indexKeys(c_getIntKeys());
+    private static final Map<String, Integer> doubleIndices = indexKeys(c_getDoubleKeys());
+
+    final boolean[] booleans = new boolean[booleanIndices.size()];
+    final int[] ints = new int[intIndices.size()];
+    final double[] doubles = new double[doubleIndices.size()];
+
+    private final BitSet changedBooleans = new BitSet();
+    private final BitSet changedInts = new BitSet();
+    private final BitSet changedDoubles = new BitSet();
+
+    RenderSettings() {}
+
+    public static boolean hasBooleanKey(@NonNull String key) {
+        return booleanIndices.containsKey(key) || key.equals(LATIN_CONSTELLATION_LABELS_KEY);
+    }
+
+    public static boolean hasIntKey(@NonNull String key) {
+        return intIndices.containsKey(key);
+    }
+
+    public static boolean hasDoubleKey(@NonNull String key) {
+        return doubleIndices.containsKey(key);
+    }
+
+    public boolean getBoolean(@NonNull String key) {
+        if (key.equals(LATIN_CONSTELLATION_LABELS_KEY))
+            return !booleans[indexOf(booleanIndices, I18N_CONSTELLATION_LABELS_KEY)];
+        return booleans[indexOf(booleanIndices, key)];
+    }
+
+    public void setBoolean(@NonNull String key, boolean value) {
+        if (key.equals(LATIN_CONSTELLATION_LABELS_KEY)) {
+            key = I18N_CONSTELLATION_LABELS_KEY;
+            value = !value;
+        }
+        int index = indexOf(booleanIndices, key);
+        booleans[index] = value;
+        changedBooleans.set(index);
+    }
+
+    public int getInt(@NonNull String key) {
+        return ints[indexOf(intIndices, key)];
+    }
+
+    public void setInt(@NonNull String key, int value) {
+        int index = indexOf(intIndices, key);
+        ints[index] = value;
+        changedInts.set(index);
+    }
+
+    public double getDouble(@NonNull String key) {
+        return doubles[indexOf(doubleIndices, key)];
+    }
+
+    public void setDouble(@NonNull String key, double value) {
+        int index = indexOf(doubleIndices, key);
+        doubles[index] = value;
+        changedDoubles.set(index);
+    }
+
+    public boolean hasChanges() {
+        return !changedBooleans.isEmpty() || !changedInts.isEmpty() || !changedDoubles.isEmpty();
+    }
+
+    int[] changedBooleanIndices() { return changedBooleans.stream().toArray(); }
+    int[] changedIntIndices() { return changedInts.stream().toArray(); }
+    int[] changedDoubleIndices() { return changedDoubles.stream().toArray(); }
+
+    void clearChanges() {
+        changedBooleans.clear();
+        changedInts.clear();
+        changedDoubles.clear();
+    }
+
+    private static int indexOf(@NonNull Map<String, Integer> indices, @NonNull String key) {
+        Integer index = indices.get(key);
+        if (index == null)
+            throw new IllegalArgumentException("Unknown render setting " + key);
+        return index;
+    }
+
+    private static @NonNull Map<String, Integer> indexKeys(@NonNull String[] keys) {
+        Map<String, Integer> indices = new HashMap<>();
+        for (int i = 0; i < keys.length; i++)
+            indices.put(keys[i], i);
+        return indices;
+    }
+
+    private static native String[] c_getBooleanKeys();
+    private static native String[] c_getIntKeys();
+    private static native String[] c_getDoubleKeys();
+}
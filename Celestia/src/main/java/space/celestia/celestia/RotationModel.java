@@ -9,6 +9,8 @@
 
 package space.celestia.celestia;
 
+import dalvik.annotation.optimization.FastNative;
+
 public class RotationModel {
     protected long pointer;
 
@@ -23,9 +25,13 @@ public class RotationModel {
     public Vector getEquatorOrientationAtTime(double julianDay) { return c_getEquatorOrientationAtTime(pointer, julianDay); }
     public Vector getSpinAtTime(double julianDay) { return c_getSpinAtTime(pointer, julianDay); }
 
+    @FastNative
     private static native boolean c_isPeriodic(long pointer);
+    @FastNative
     private static native double c_getPeriod(long pointer);
+    @FastNative
     private static native double c_getValidBeginTime(long pointer);
+    @FastNative
     private static native double c_getValidEndTime(long pointer);
 
     private static native Vector c_getAngularVelocityAtTime(long pointer, double julianDay);
@@ -30,6 +30,11 @@ public class Selection implements Parcelable {
     }
 
     public Selection(long objectPointer, int type) {
+        this(objectPointer, type, type == SELECTION_TYPE_DEEP_SKY && DSOCatalog.c_isDSOGalaxy(objectPointer));
+    }
+
+    // For callers that already know whether a deep sky object is a galaxy
+    Selection(long objectPointer, int type, boolean isGalaxy) {
         switch (type)
         {
             case SELECTION_TYPE_STAR:
@@ -39,7 +44,7 @@ public class Selection implements Parcelable {
                 object = new Body(objectPointer);
                 break;
             case SELECTION_TYPE_DEEP_SKY:
-                if (DSOCatalog.c_isDSOGalaxy(objectPointer)) {
+                if (isGalaxy) {
                     object = new Galaxy(objectPointer);
                 } else {
                     object = new DSO(objectPointer);
@@ -9,7 +9,10 @@
 
 package space.celestia.celestia;
 
+import android.os.CancellationSignal;
+
 import androidx.annotation.NonNull;
+import androidx.annotation.Nullable;
 
 import java.util.List;
 
@@ -27,7 +30,11 @@ public class Simulation {
     }
 
     public @NonNull List<Completion> completionForText(@NonNull String text, int limit) {
-        return c_completionForText(pointer, text, limit);
+        return completionForText(text, limit, null);
+    }
+
+    public @NonNull List<Completion> completionForText(@NonNull String text, int limit, @Nullable CancellationSignal cancellationSignal) {
+        return c_completionForText(pointer, text, limit, cancellationSignal);
     }
 
     public @NonNull
@@ -89,7 +96,7 @@ public class Simulation {
     private static native Selection c_getSelection(long pointer);
     private static native void c_setSelection(long pointer, Selection selection);
     private static native long c_getUniverse(long pointer);
-    private static native List<Completion> c_completionForText(long pointer, String text, int limit);
+    private static native List<Completion> c_completionForText(long pointer, String text, int limit, CancellationSignal cancellationSignal);
     private static native Selection c_findObject(long pointer, String name);
     private static native void c_reverseObserverOrientation(long pointer);
     private static native double c_getTime(long pointer);
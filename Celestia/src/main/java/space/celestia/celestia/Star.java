@@ -19,7 +19,9 @@ public class Star extends AstroObject {
 
     @NonNull
     public UniversalCoord getPositionAtTime(double julianDay) {
-        return new UniversalCoord(c_getPositionAtTime(pointer, julianDay));
+        long[] value = new long[UniversalCoord.PACKED_LENGTH];
+        c_getPositionAtTime(pointer, julianDay, value);
+        return new UniversalCoord(value);
     }
 
     public String getSpectralType() {
@@ -27,6 +29,6 @@ public class Star extends AstroObject {
     }
 
     // C functions
-    private static native long c_getPositionAtTime(long pointer, double julianDay);
+    private static native void c_getPositionAtTime(long pointer, double julianDay, long[] position);
     private static native String c_getSpectralType(long pointer);
 }
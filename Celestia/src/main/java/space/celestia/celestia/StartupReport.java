@@ -0,0 +1,85 @@
+// StartupReport.java
+//
+// Copyright (C) 2025, Celestia Development Team
+//
+// This program is free software; you can redistribute it and/or
+// modify it under the terms of the GNU General Public License
+// as published by the Free Software Foundation; either version 2
+// of the License, or (at your option) any later version.
+
+package space.celestia.celestia;
+
+import androidx.annotation.NonNull;
+
+import java.util.ArrayList;
+import java.util.Collections;
+import java.util.List;
+
+/**
+ * Where startup time went, from {@link AppCore#startSimulation} to the first
+ * frame drawn, see {@link AppCore#getStartupReport()}. There is one phase
+ * per file reported by the progress watcher, plus renderer set up, fonts,
+ * scripts menu and the first frame. Empty unless a report path was set with
+ * {@link AppCore#setStartupReportPath}.
+ */
+public final class StartupReport {
+    // Must match CelestiaStartupProfiler.cpp
+    private static final int DOUBLE_COUNT = 2;
+    private static final int LONG_COUNT = 2;
+
+    public static final class Phase {
+        public final @NonNull String name;
+        // Seconds, CPU time is for the thread that ran the phase
+        public final double wallTime;
+        public final double cpuTime;
+        public final long bytesRead;
+        // Heap in use when the phase last ended, not a peak
+        public final long heapBytesAtEnd;
+
+        Phase(@NonNull String name, double wallTime, double cpuTime, long bytesRead, long heapBytesAtEnd) {
+            this.name = name;
+            this.wallTime = wallTime;
+            this.cpuTime = cpuTime;
+            this.bytesRead = bytesRead;
+            this.heapBytesAtEnd = heapBytesAtEnd;
+        }
+    }
+
+    public final @NonNull List<Phase> phases;
+    public final long starCount;
+    public final long dsoCount;
+    // False until the first frame has been drawn
+    public final boolean complete;
+
+    private StartupReport(@NonNull List<Phase> phases, long starCount, long dsoCount, boolean complete) {
+        this.phases = phases;
+        this.starCount = starCount;
+        this.dsoCount = dsoCount;
+        this.complete = complete;
+    }
+
+    public double getTotalWallTime() {
+        double total = 0.0;
+        for (Phase phase : phases)
+            total += phase.wallTime;
+        return total;
+    }
+
+    static @NonNull StartupReport current() {
+        int capacity = c_getPhaseCount();
+        String[] names = new String[capacity];
+        double[] doubles = new double[capacity * DOUBLE_COUNT];
+        long[] longs = new long[capacity * LONG_COUNT];
+        long[] totals = new long[3];
+        int count = c_getReport(names, doubles, longs, totals);
+
+        List<Phase> phases = new ArrayList<>(count);
+        for (int i = 0; i < count; i++) {
+            phases.add(new Phase(names[i], doubles[i * DOUBLE_COUNT], doubles[i * DOUBLE_COUNT + 1], longs[i * LONG_COUNT], longs[i * LONG_COUNT + 1]));
+        }
+        return new StartupReport(Collections.unmodifiableList(phases), totals[0], totals[1], totals[2] != 0);
+    }
+
+    private static native int c_getPhaseCount();
+    private static native int c_getReport(String[] names, double[] doubles, long[] longs, long[] totals);
+}
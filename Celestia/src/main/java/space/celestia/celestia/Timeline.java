@@ -1,5 +1,7 @@
 package space.celestia.celestia;
 
+import dalvik.annotation.optimization.FastNative;
+
 import androidx.annotation.NonNull;
 
 public class Timeline {
@@ -35,6 +37,7 @@ public class Timeline {
         }
     }
 
+    @FastNative
     private static native int c_getPhaseCount(long pointer);
     private static native Phase c_getPhase(int index, long pointer);
 }
@@ -11,42 +11,31 @@ package space.celestia.celestia;
 
 import androidx.annotation.NonNull;
 
-public class UniversalCoord implements AutoCloseable {
-    private long pointer;
-    protected UniversalCoord(long ptr) { pointer = ptr; }
+public class UniversalCoord {
+    // x, y and z are 128-bit fixed point values, stored as low and high 64 bits each
+    static final int PACKED_LENGTH = 6;
 
-    private static UniversalCoord zero = null;
-    private boolean closed = false;
+    final long[] value;
+
+    UniversalCoord(@NonNull long[] value) { this.value = value; }
+
+    private static final UniversalCoord zero = new UniversalCoord(new long[PACKED_LENGTH]);
 
     @NonNull
     public static UniversalCoord getZero() {
-        if (zero == null)
-            zero = new UniversalCoord(c_getZero());
         return zero;
     }
 
     public double distanceFrom(@NonNull UniversalCoord otherCoord) {
-        return c_distanceFrom(pointer, otherCoord.pointer);
+        return c_distanceFrom(value, otherCoord.value);
     }
 
     @NonNull
     public Vector offsetFrom(@NonNull UniversalCoord otherCoord) {
-        return c_offsetFrom(pointer, otherCoord.pointer);
-    }
-
-    @Override
-    public void close() throws Exception {
-        if (!closed) {
-            c_destroy(pointer);
-            closed = true;
-        }
+        return c_offsetFrom(value, otherCoord.value);
     }
 
     // C functions
-    private static native long c_getZero();
-
-    private static native double c_distanceFrom(long ptr1, long ptr2);
-    private static native Vector c_offsetFrom(long ptr1, long ptr2);
-
-    private static native void c_destroy(long pointer);
+    private static native double c_distanceFrom(long[] coord1, long[] coord2);
+    private static native Vector c_offsetFrom(long[] coord1, long[] coord2);
 }
@@ -12,6 +12,9 @@ package space.celestia.celestia;
 import androidx.annotation.NonNull;
 import androidx.annotation.Nullable;
 
+import java.util.ArrayList;
+import java.util.Collections;
+import java.util.List;
 import java.util.Map;
 
 public class Universe implements BrowserItem.ChildrenProvider {
@@ -104,6 +107,36 @@ public class Universe implements BrowserItem.ChildrenProvider {
         return c_getWebInfoURLForSelection(pointer, selection);
     }
 
+    /**
+     * Everything the info overview needs about {@code selection} in a single native call.
+     */
+    public @NonNull ObjectInfo getObjectInfo(@NonNull Selection selection, double julianDay) {
+        return getObjectInfo(Collections.singletonList(selection), julianDay).get(0);
+    }
+
+    /**
+     * Bulk form of {@link #getObjectInfo(Selection, double)}, one native call for the whole list.
+     */
+    public @NonNull List<ObjectInfo> getObjectInfo(@NonNull List<Selection> selections, double julianDay) {
+        int count = selections.size();
+        long[] pointers = new long[count];
+        int[] types = new int[count];
+        for (int i = 0; i < count; i++) {
+            Selection selection = selections.get(i);
+            pointers[i] = selection.getObjectPointer();
+            types[i] = selection.type;
+        }
+        int[] ints = new int[count * ObjectInfo.INT_COUNT];
+        double[] doubles = new double[count * ObjectInfo.DOUBLE_COUNT];
+        String[] strings = new String[count * ObjectInfo.STRING_COUNT];
+        c_getObjectInfo(pointer, pointers, types, julianDay, ints, doubles, strings);
+
+        List<ObjectInfo> results = new ArrayList<>(count);
+        for (int i = 0; i < count; i++)
+            results.add(new ObjectInfo(selections.get(i), i, ints, doubles, strings));
+        return results;
+    }
+
     // C functions
     private static native long c_getStarCatalog(long ptr);
     private static native long c_getDSOCatalog(long ptr);
@@ -115,4 +148,5 @@ public class Universe implements BrowserItem.ChildrenProvider {
     private static native void c_unmark(long ptr, Selection selection);
     private static native void c_unmarkAll(long ptr);
     private static native String c_getWebInfoURLForSelection(long pointer, Selection selection);
+    private static native void c_getObjectInfo(long pointer, long[] objectPointers, int[] objectTypes, double julianDay, int[] ints, double[] doubles, String[] strings);
 }
@@ -21,7 +21,7 @@ public class Vector {
         array = new double[] {x, y, z, w};
     }
 
-    private Vector(double x, double y, double z) {
+    Vector(double x, double y, double z) {
         array = new double[] {x, y, z};
     }
 }
@@ -15,6 +15,7 @@ import android.view.Surface;
 import androidx.annotation.NonNull;
 import androidx.annotation.Nullable;
 
+import java.nio.ByteBuffer;
 import java.util.ArrayList;
 import java.util.List;
 
@@ -35,10 +36,14 @@ public class Renderer implements AutoCloseable {
     private boolean closed = false;
 
     private EngineStartedListener engineStartedListener = null;
+    private ObserverState observerState = null;
 
     @Override
-    public void close() throws Exception {
+    public synchronized void close() throws Exception {
         if (!closed) {
+            // The observer state block is freed with the native renderer
+            if (observerState != null)
+                observerState.detach();
             c_destroy(pointer);
             closed = true;
         }
@@ -118,6 +123,19 @@ public class Renderer implements AutoCloseable {
         return c_hasPresentationSurface(pointer);
     }
 
+    /**
+     * Observer state published by the render thread every frame, can be
+     * read from any thread without going through the task queue. Publishing
+     * starts with the first call, until then frames skip it.
+     */
+    public synchronized @NonNull ObserverState getObserverState() {
+        if (closed)
+            throw new IllegalStateException("Renderer is closed");
+        if (observerState == null)
+            observerState = new ObserverState(c_getObserverStateFeed(pointer), c_getObserverStateBuffer(pointer));
+        return observerState;
+    }
+
     public interface EngineStartedListener {
         boolean onEngineStarted(int samples);
     }
@@ -164,4 +182,6 @@ public class Renderer implements AutoCloseable {
     private native float c_getRenderingScaleX(long pointer);
     private native float c_getRenderingScaleY(long pointer);
     private native boolean c_hasPresentationSurface(long pointer);
+    private native long c_getObserverStateFeed(long pointer);
+    private native ByteBuffer c_getObserverStateBuffer(long pointer);
 }
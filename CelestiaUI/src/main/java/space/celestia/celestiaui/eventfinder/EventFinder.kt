@@ -53,7 +53,10 @@ import space.celestia.celestiaui.utils.julianDay
 
 sealed class EventFinderAlert {
     data object ObjectNotFound : EventFinderAlert()
-    data class Calculating(val finder: EclipseFinder): EventFinderAlert()
+    class Calculating(val finder: EclipseFinder): EventFinderAlert() {
+        // Set from the dialog, checked by the search after each batch
+        @Volatile var isStopped = false
+    }
 }
 
 @OptIn(ExperimentalMaterial3Api::class)
@@ -116,20 +119,27 @@ fun EventFinder() {
                                     return@launch
                                 }
                                 val finder = EclipseFinder(body)
-                                alert = EventFinderAlert.Calculating(finder)
+                                val calculating = EventFinderAlert.Calculating(finder)
+                                alert = calculating
                                 val results = withContext(Dispatchers.IO) {
+                                    val found = ArrayList<EclipseFinder.Eclipse>()
                                     finder.search(
                                         startDate.julianDay,
                                         endDate.julianDay,
                                         EclipseFinder.ECLIPSE_KIND_LUNAR or EclipseFinder.ECLIPSE_KIND_SOLAR
-                                    )
+                                    ) { batch ->
+                                        found.addAll(batch)
+                                        !calculating.isStopped
+                                    }
+                                    found
                                 }
                                 finder.close()
-                                alert?.let { content ->
-                                    if (content is EventFinderAlert.Calculating && content.finder == finder) {
-                                        alert = null
-                                        backStack.add(Page.Results(results))
-                                    }
+                                if (alert === calculating) {
+                                    alert = null
+                                    backStack.add(Page.Results(results))
+                                } else if (calculating.isStopped && results.isNotEmpty()) {
+                                    // Show what was found before the search was stopped
+                                    backStack.add(Page.Results(results))
                                 }
                             }
                         }
@@ -160,6 +170,7 @@ fun EventFinder() {
                     alert = null
                 }, onConfirm = {
                     alert = null
+                    content.isStopped = true
                     content.finder.abort()
                 }, title = CelestiaString("Calculating…", "Calculating for eclipses"), confirmButtonText = CelestiaString("Cancel", ""), dismissOnBackPressOrClickOutside = false)
             }
@@ -9,6 +9,7 @@
 
 package space.celestia.celestiaui.search
 
+import android.os.CancellationSignal
 import androidx.compose.foundation.background
 import androidx.compose.foundation.clickable
 import androidx.compose.foundation.layout.Box
@@ -86,6 +87,7 @@ fun SearchScreen(linkClicked: (String) -> Unit, openSubsystem: (Selection) -> Un
         mutableStateOf(false)
     }
     var alert by remember { mutableStateOf<SearchAlert?>(null) }
+    var pendingCompletion by remember { mutableStateOf<CancellationSignal?>(null) }
     val scope = rememberCoroutineScope()
     Scaffold(topBar = {
         SearchBar(
@@ -95,8 +97,11 @@ fun SearchScreen(linkClicked: (String) -> Unit, openSubsystem: (Selection) -> Un
                     onQueryChange = {
                         searchKey = it
                         isSearching = true
+                        pendingCompletion?.cancel()
+                        val cancellationSignal = CancellationSignal()
+                        pendingCompletion = cancellationSignal
                         scope.launch {
-                            val result = if (it.isEmpty()) listOf<Completion>() else withContext(viewModel.executor.asCoroutineDispatcher()) { viewModel.appCore.simulation.completionForText(it, 100) }
+                            val result = if (it.isEmpty()) listOf<Completion>() else withContext(viewModel.executor.asCoroutineDispatcher()) { viewModel.appCore.simulation.completionForText(it, 100, cancellationSignal) }
                             if (searchKey == it) {
                                 searchResults = result
                                 isSearching = false
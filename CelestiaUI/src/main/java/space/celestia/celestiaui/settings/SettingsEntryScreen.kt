@@ -33,6 +33,8 @@ import androidx.hilt.lifecycle.viewmodel.compose.hiltViewModel
 import androidx.lifecycle.compose.dropUnlessResumed
 import kotlinx.coroutines.asCoroutineDispatcher
 import kotlinx.coroutines.launch
+import kotlinx.coroutines.withContext
+import space.celestia.celestia.RenderSettings
 import space.celestia.celestiaui.R
 import space.celestia.celestiaui.compose.CheckboxRow
 import space.celestia.celestiaui.compose.Footer
@@ -61,6 +63,10 @@ import space.celestia.celestiaui.utils.PreferenceManager
 
 @Composable
 fun SettingsEntryScreen(item: SettingsCommonItem, paddingValues: PaddingValues, linkClicked: (String, Boolean) -> Unit) {
+    val viewModel: SettingsViewModel = hiltViewModel()
+    // One native snapshot for the whole page instead of a call per row, rows
+    // write their edits into it and it is replaced when an edit changes others
+    var renderSettings by remember(item) { mutableStateOf(viewModel.appCore.renderSettings) }
     LazyColumn(modifier = Modifier
         .nestedScroll(rememberNestedScrollInteropConnection()), contentPadding = paddingValues) {
         for (index in item.sections.indices) {
@@ -74,7 +80,7 @@ fun SettingsEntryScreen(item: SettingsCommonItem, paddingValues: PaddingValues,
                 }
             }
             items(section.rows) { item ->
-                SettingEntry(item = item)
+                SettingEntry(item = item, renderSettings = renderSettings, onRenderSettingsChange = { renderSettings = it })
             }
             item {
                 val footer = section.footer
@@ -111,13 +117,25 @@ fun SettingsEntryScreen(item: SettingsCommonItem, paddingValues: PaddingValues,
 }
 
 @Composable
-private fun SettingEntry(item: SettingsItem) {
+private fun SettingEntry(item: SettingsItem, renderSettings: RenderSettings, onRenderSettingsChange: (RenderSettings) -> Unit) {
     val viewModel: SettingsViewModel = hiltViewModel()
     val scope = rememberCoroutineScope()
+    fun setBooleanValue(key: String, value: Boolean) {
+        if (RenderSettings.hasBooleanKey(key))
+            renderSettings.setBoolean(key, value)
+        scope.launch {
+            // Re-read afterwards, toggling AutoMag also changes FaintestVisible
+            val updated = withContext(viewModel.executor.asCoroutineDispatcher()) {
+                viewModel.appCore.setBooleanValueForField(key, value)
+                viewModel.appCore.renderSettings
+            }
+            onRenderSettingsChange(updated)
+        }
+    }
     when (item) {
         is SettingsSwitchItem -> {
-            var on by remember {
-                mutableStateOf(viewModel.appCore.getBooleanValueForPield(item.key))
+            var on by remember(renderSettings) {
+                mutableStateOf(if (RenderSettings.hasBooleanKey(item.key)) renderSettings.getBoolean(item.key) else viewModel.appCore.getBooleanValueForPield(item.key))
             }
             when (item.representation) {
                 SettingsSwitchItem.Representation.Switch -> {
@@ -125,9 +143,7 @@ private fun SettingEntry(item: SettingsItem) {
                         on = newValue
                         if (!item.volatile)
                             viewModel.coreSettings[PreferenceManager.CustomKey(item.key)] = if (newValue) "1" else "0"
-                        scope.launch(viewModel.executor.asCoroutineDispatcher()) {
-                            viewModel.appCore.setBooleanValueForField(item.key, newValue)
-                        }
+                        setBooleanValue(item.key, newValue)
                     })
                 }
                 SettingsSwitchItem.Representation.Checkmark -> {
@@ -135,17 +151,15 @@ private fun SettingEntry(item: SettingsItem) {
                         on = newValue
                         if (!item.volatile)
                             viewModel.coreSettings[PreferenceManager.CustomKey(item.key)] = if (newValue) "1" else "0"
-                        scope.launch(viewModel.executor.asCoroutineDispatcher()) {
-                            viewModel.appCore.setBooleanValueForField(item.key, newValue)
-                        }
+                        setBooleanValue(item.key, newValue)
                     })
                 }
             }
         }
 
         is SettingsSelectionSingleItem -> {
-            var selected by remember {
-                val value = viewModel.appCore.getIntValueForField(item.key)
+            var selected by remember(renderSettings) {
+                val value = if (RenderSettings.hasIntKey(item.key)) renderSettings.getInt(item.key) else viewModel.appCore.getIntValueForField(item.key)
                 mutableIntStateOf(
                     if (item.options.any { it.first == value }) {
                         value
@@ -161,6 +175,8 @@ private fun SettingEntry(item: SettingsItem) {
                 RadioButtonRow(primaryText = option.second, selected = option.first == selected) {
                     selected = option.first
                     viewModel.coreSettings[PreferenceManager.CustomKey(item.key)] = option.first.toString()
+                    if (RenderSettings.hasIntKey(item.key))
+                        renderSettings.setInt(item.key, option.first)
                     scope.launch(viewModel.executor.asCoroutineDispatcher()) {
                         viewModel.appCore.setIntValueForField(item.key, option.first)
                     }
@@ -246,13 +262,15 @@ private fun SettingEntry(item: SettingsItem) {
                 }
             }
             val valueRange = if (isLog) 0f..1f else item.minValue.toFloat()..item.maxValue.toFloat()
-            var value by remember {
-                mutableFloatStateOf(actualToSlider(viewModel.appCore.getDoubleValueForField(item.key)))
+            var value by remember(renderSettings) {
+                mutableFloatStateOf(actualToSlider(if (RenderSettings.hasDoubleKey(item.key)) renderSettings.getDouble(item.key) else viewModel.appCore.getDoubleValueForField(item.key)))
             }
             SliderRow(primaryText = item.name, secondaryText = item.subtitle, value = value, valueRange = valueRange, onValueChange = { newValue ->
                 value = newValue
                 val actual = sliderToActual(newValue)
                 viewModel.coreSettings[PreferenceManager.CustomKey(item.key)] = actual.toString()
+                if (RenderSettings.hasDoubleKey(item.key))
+                    renderSettings.setDouble(item.key, actual)
                 scope.launch(viewModel.executor.asCoroutineDispatcher()) {
                     viewModel.appCore.setDoubleValueForField(item.key, actual)
                 }
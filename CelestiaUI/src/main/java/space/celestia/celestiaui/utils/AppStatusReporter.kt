@@ -15,6 +15,7 @@ class AppStatusReporter : ProgressWatcher {
     private val listeners = arrayListOf<Listener>()
     private var _status = ""
     private var _state = State.NONE
+    private var _progress: Float? = null
     private val lock = Any()
 
     enum class State(val value: Int) {
@@ -34,9 +35,14 @@ class AppStatusReporter : ProgressWatcher {
     val status: String
         get() = synchronized(lock) { return _status }
 
+    // Fraction of the catalog data loaded, null while unknown
+    val progress: Float?
+        get() = synchronized(lock) { return _progress }
+
     interface Listener {
         fun celestiaLoadingProgress(status: String)
         fun celestiaLoadingStateChanged(newState: State)
+        fun celestiaLoadingFractionChanged(progress: Float?) {}
     }
 
     fun register(listener: Listener) {
@@ -51,6 +57,11 @@ class AppStatusReporter : ProgressWatcher {
         updateStatus(String.format(CelestiaString("Loading: %s", "Celestia initialization, loading file"), progress))
     }
 
+    override fun onCelestiaProgress(progress: String, bytesDone: Long, bytesTotal: Long) {
+        updateProgress(if (bytesTotal > 0) bytesDone.toFloat() / bytesTotal.toFloat() else null)
+        onCelestiaProgress(progress)
+    }
+
     fun updateState(state: State) {
         var currentListeners: ArrayList<Listener>
         synchronized(lock) {
@@ -63,6 +74,19 @@ class AppStatusReporter : ProgressWatcher {
         }
     }
 
+    private fun updateProgress(progress: Float?) {
+        var currentListeners: ArrayList<Listener>
+        synchronized(lock) {
+            if (_progress == progress) return
+            _progress = progress
+            currentListeners = ArrayList(listeners.size)
+            currentListeners.addAll(listeners)
+        }
+        for (listener in currentListeners) {
+            listener.celestiaLoadingFractionChanged(progress)
+        }
+    }
+
     fun updateStatus(status: String) {
         var currentListeners: ArrayList<Listener>
         synchronized(lock) {
@@ -28,15 +28,15 @@ val AppCore.currentBookmark: BookmarkNode?
     }
 
 fun AppCore.getOverviewForSelection(selection: Selection, linkHandler: ((String) -> Unit)?): AnnotatedString {
-    return when (val obj = selection.`object`) {
+    return when (selection.`object`) {
         is Body -> {
-            getOverviewForBody(obj, linkHandler)
+            getOverviewForBody(simulation.universe.getObjectInfo(selection, simulation.time), linkHandler)
         }
         is Star -> {
-            AnnotatedString(getOverviewForStar(obj))
+            AnnotatedString(getOverviewForStar(simulation.universe.getObjectInfo(selection, simulation.time)))
         }
         is DSO -> {
-            AnnotatedString(getOverviewForDSO(obj))
+            AnnotatedString(getOverviewForDSO(simulation.universe.getObjectInfo(selection, simulation.time)))
         }
         else -> {
             AnnotatedString(CelestiaString("No overview available.", "No overview for an object"))
@@ -44,10 +44,10 @@ fun AppCore.getOverviewForSelection(selection: Selection, linkHandler: ((String)
     }
 }
 
-private fun AppCore.getOverviewForBody(body: Body, linkHandler: ((String) -> Unit)?): AnnotatedString {
+private fun AppCore.getOverviewForBody(body: ObjectInfo, linkHandler: ((String) -> Unit)?): AnnotatedString {
     val lines = arrayListOf<String>()
 
-    val radius = body.radius
+    val radius = body.radius.toFloat()
     val radiusString: String
     val oneMiInKm = 1.609344f
     val oneFtInKm = 0.0003048f
@@ -74,16 +74,12 @@ private fun AppCore.getOverviewForBody(body: Body, linkHandler: ((String) -> Uni
         CelestiaString("Size: %s", "Size of an object").format(radiusString)
     })
 
-    val time = simulation.time
-    val orbit = body.getOrbitAtTime(time)
-    val rotation = body.getRotationModelAtTime(time)
-
-    val orbitalPeriod: Double = if (orbit.isPeriodic) orbit.period else 0.0
-    if (rotation.isPeriodic && body.type != Body.BODY_TYPE_SPACECRAFT) {
-        var rotPeriod = rotation.period
+    val orbitalPeriod: Double = if (body.isOrbitPeriodic) body.orbitalPeriod else 0.0
+    if (body.isRotationPeriodic && body.subtype != Body.BODY_TYPE_SPACECRAFT) {
+        var rotPeriod = body.rotationPeriod
         var dayLength = 0.0
 
-        if (orbit.isPeriodic) {
+        if (body.isOrbitPeriodic) {
             val siderealDaysPerYear = orbitalPeriod / rotPeriod
             val solarDaysPerYear = siderealDaysPerYear - 1.0
             if (solarDaysPerYear > 0.0001) {
@@ -118,10 +114,9 @@ private fun AppCore.getOverviewForBody(body: Body, linkHandler: ((String) -> Uni
     data class TimeLink(val line: String, val timeString: String, val julianDay: Double)
     val timeLinks = arrayListOf<TimeLink>()
 
-    val timeline = body.timeline
-    if (timeline.phaseCount > 0) {
-        val startTime = timeline.getPhase(0).startTime
-        val endTime = timeline.getPhase(timeline.phaseCount - 1).endTime
+    if (body.hasTimeline()) {
+        val startTime = body.startTime
+        val endTime = body.endTime
         val formatter = DateFormat.getDateTimeInstance(DateFormat.SHORT, DateFormat.SHORT, Locale.getDefault())
         if (!startTime.isInfinite()) {
             val timeString = formatter.format(Utils.createDateFromJulianDay(startTime))
@@ -154,13 +149,12 @@ private fun AppCore.getOverviewForBody(body: Body, linkHandler: ((String) -> Uni
     }
 }
 
-private fun AppCore.getOverviewForStar(star: Star): String {
+private fun getOverviewForStar(star: ObjectInfo): String {
     val lines = arrayListOf<String>()
 
-    lines.add(CelestiaString("Spectral type: %s", "").format(star.spectralType))
+    lines.add(CelestiaString("Spectral type: %s", "").format(star.detail ?: ""))
 
-    val time = simulation.time
-    val celPos = star.getPositionAtTime(time).use{ it.offsetFrom(UniversalCoord.getZero()) }
+    val celPos = star.position
     val eqPos = Utils.eclipticToEquatorial(Utils.celToJ2000Ecliptic(celPos))
     val sph = Utils.rectToSpherical(eqPos)
 
@@ -177,10 +171,10 @@ private fun AppCore.getOverviewForStar(star: Star): String {
     return lines.joinToString(separator = "\n")
 }
 
-private fun getOverviewForDSO(dso: DSO): String {
+private fun getOverviewForDSO(dso: ObjectInfo): String {
     val lines = arrayListOf<String>()
 
-    lines.add(dso.description)
+    lines.add(dso.detail ?: "")
 
     val celPos = dso.position
     val eqPos = Utils.eclipticToEquatorial(Utils.celToJ2000Ecliptic(celPos))
@@ -0,0 +1,69 @@
+// NativeCallBenchmark.kt
+//
+// Copyright (C) 2025, Celestia Development Team
+//
+// This program is free software; you can redistribute it and/or
+// modify it under the terms of the GNU General Public License
+// as published by the Free Software Foundation; either version 2
+// of the License, or (at your option) any later version.
+
+package space.celestia.mobilecelestia
+
+import android.os.Bundle
+import android.util.Log
+import androidx.test.ext.junit.runners.AndroidJUnit4
+import androidx.test.platform.app.InstrumentationRegistry
+import org.junit.Assert.assertEquals
+import org.junit.Test
+import org.junit.runner.RunWith
+import space.celestia.celestia.AppCore
+
+/**
+ * Compares the cost of a native getter registered with RegisterNatives and
+ * marked @FastNative against one still resolved by name with a regular JNI
+ * transition. Both getters only read one field of CelestiaCore, so the
+ * difference is the call overhead. Results are reported as instrumentation
+ * status, run with:
+ *
+ * ./gradlew :app:connectedAndroidTest -Pandroid.testInstrumentationRunnerArguments.class=space.celestia.mobilecelestia.NativeCallBenchmark
+ */
+@RunWith(AndroidJUnit4::class)
+class NativeCallBenchmark {
+    @Test
+    fun compareFastNativeWithRegularCalls() {
+        val appCore = AppCore()
+        appCore.screenDPI = 160
+        appCore.showStars = true
+
+        var sink = 0
+        val regular = nanosPerCall { sink += appCore.screenDPI }
+        val fastNative = nanosPerCall { if (appCore.showStars) sink += 1 }
+        assertEquals(160L * TOTAL_CALLS + TOTAL_CALLS, sink.toLong())
+
+        val results = Bundle()
+        results.putDouble("regularNanosPerCall", regular)
+        results.putDouble("fastNativeNanosPerCall", fastNative)
+        InstrumentationRegistry.getInstrumentation().sendStatus(0, results)
+        Log.i(TAG, "Regular JNI: %.1f ns/call, registered @FastNative: %.1f ns/call".format(regular, fastNative))
+    }
+
+    // Best of several runs, after a warm up so both methods are compiled
+    private inline fun nanosPerCall(call: () -> Unit): Double {
+        repeat(WARM_UP_CALLS) { call() }
+        var best = Long.MAX_VALUE
+        repeat(RUN_COUNT) {
+            val start = System.nanoTime()
+            repeat(CALLS_PER_RUN) { call() }
+            best = minOf(best, System.nanoTime() - start)
+        }
+        return best.toDouble() / CALLS_PER_RUN
+    }
+
+    private companion object {
+        const val TAG = "NativeCallBenchmark"
+        const val WARM_UP_CALLS = 100_000
+        const val RUN_COUNT = 5
+        const val CALLS_PER_RUN = 1_000_000
+        const val TOTAL_CALLS = WARM_UP_CALLS + RUN_COUNT * CALLS_PER_RUN
+    }
+}
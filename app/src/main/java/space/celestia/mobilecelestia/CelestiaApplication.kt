@@ -23,4 +23,10 @@ class CelestiaApplication: Application() {
             setUpFlavor()
         }
     }
+
+    override fun onTrimMemory(level: Int) {
+        super.onTrimMemory(level)
+
+        AppCore.trimMemory(level)
+    }
 }
\ No newline at end of file
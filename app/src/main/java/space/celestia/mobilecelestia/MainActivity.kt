@@ -106,6 +106,7 @@ import org.json.JSONObject
 import space.celestia.celestia.AppCore
 import space.celestia.celestia.Body
 import space.celestia.celestia.BrowserItem
+import space.celestia.celestia.RenderSettings
 import space.celestia.celestia.Renderer
 import space.celestia.celestia.Selection
 import space.celestia.celestia.Universe
@@ -1092,17 +1093,30 @@ class MainActivity : AppCompatActivity(R.layout.activity_main),
                 doubles[key.valueString] = cus
         }
 
+        // Apply everything the packed render settings cover in one transition,
+        // fall back to the individual accessors for the rest
+        val renderSettings = appCore.renderSettings
         for ((key, value) in bools) {
-            appCore.setBooleanValueForField(key, value)
+            if (RenderSettings.hasBooleanKey(key))
+                renderSettings.setBoolean(key, value)
+            else
+                appCore.setBooleanValueForField(key, value)
         }
 
         for ((key, value) in ints) {
-            appCore.setIntValueForField(key, value)
+            if (RenderSettings.hasIntKey(key))
+                renderSettings.setInt(key, value)
+            else
+                appCore.setIntValueForField(key, value)
         }
 
         for ((key, value) in doubles) {
-            appCore.setDoubleValueForField(key, value)
+            if (RenderSettings.hasDoubleKey(key))
+                renderSettings.setDouble(key, value)
+            else
+                appCore.setDoubleValueForField(key, value)
         }
+        appCore.applyRenderSettings(renderSettings)
     }
 
     private fun readDefaultSetting(): Map<String, Any> {
@@ -33,10 +33,12 @@ import space.celestia.celestia.AppCore
 import space.celestia.celestiaui.settings.viewmodel.boldFont
 import space.celestia.celestiaui.settings.viewmodel.normalFont
 import space.celestia.celestiaui.utils.AppStatusReporter
+import space.celestia.mobilecelestia.BuildConfig
 import space.celestia.mobilecelestia.MainActivity
 import space.celestia.mobilecelestia.celestia.viewmodel.RendererSettings
 import space.celestia.mobilecelestia.celestia.viewmodel.RendererViewModel
 import space.celestia.mobilecelestia.common.EdgeInsets
+import java.io.File
 import java.util.Locale
 
 @Composable
@@ -86,6 +88,15 @@ fun RendererScreen(pathToLoad: String, cfgToLoad: String, addonDirsToLoad: List<
 
         AppCore.initGL()
         AppCore.chdir(pathToLoad)
+        // Profiling startup is for development builds only
+        if (BuildConfig.DEBUG) {
+            val reportFile = File(viewModel.defaultFilePaths.parentDirectoryPath, startupReportFileName)
+            // Log the last launch before the report is overwritten
+            val lastReport = if (reportFile.exists()) StartupReportFile.decode(reportFile.readText()) else null
+            if (lastReport != null)
+                Log.d("RendererScreen", "Last startup: ${lastReport.summary()}")
+            AppCore.setStartupReportPath(reportFile.path)
+        }
 
         val countryCode = Locale.getDefault().country
 
@@ -298,4 +309,6 @@ fun AppCore.updateContentScale(rendererSettings: RendererSettings, changes: Rend
     if (changes.scaling || changes.safeArea) {
         setSafeAreaInsets(rendererSettings.safeAreaInsets.scaleBy(rendererSettings.scaleFactor))
     }
-}
\ No newline at end of file
+}
+
+private const val startupReportFileName = "startup_report.json"
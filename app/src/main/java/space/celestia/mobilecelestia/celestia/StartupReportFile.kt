@@ -0,0 +1,46 @@
+// StartupReportFile.kt
+//
+// Copyright (C) 2025, Celestia Development Team
+//
+// This program is free software; you can redistribute it and/or
+// modify it under the terms of the GNU General Public License
+// as published by the Free Software Foundation; either version 2
+// of the License, or (at your option) any later version.
+
+package space.celestia.mobilecelestia.celestia
+
+import kotlinx.serialization.Serializable
+import kotlinx.serialization.json.Json
+import java.util.Locale
+
+// The JSON startup report written by CelestiaStartupProfiler.cpp after the first frame
+@Serializable
+data class StartupReportFile(val starCount: Long, val dsoCount: Long, val phases: List<Phase>) {
+    @Serializable
+    data class Phase(val name: String, val wallTime: Double, val cpuTime: Double, val bytesRead: Long, val heapBytesAtEnd: Long)
+
+    val totalWallTime: Double
+        get() = phases.sumOf { it.wallTime }
+
+    fun slowestPhases(count: Int): List<Phase> {
+        return phases.sortedByDescending { it.wallTime }.take(count)
+    }
+
+    fun summary(slowestCount: Int = 3): String {
+        val slowest = slowestPhases(slowestCount).joinToString { String.format(Locale.US, "%s %.3f s", it.name, it.wallTime) }
+        return String.format(Locale.US, "%.3f s to first frame, %d stars, %d DSOs, slowest: %s", totalWallTime, starCount, dsoCount, slowest)
+    }
+
+    companion object {
+        private val json = Json { ignoreUnknownKeys = true }
+
+        fun decode(text: String): StartupReportFile? {
+            return try {
+                json.decodeFromString<StartupReportFile>(text)
+            } catch (_: IllegalArgumentException) {
+                // SerializationException, thrown for malformed or truncated reports, is one
+                null
+            }
+        }
+    }
+}
@@ -15,14 +15,17 @@ import androidx.compose.foundation.layout.Arrangement
 import androidx.compose.foundation.layout.Box
 import androidx.compose.foundation.layout.Column
 import androidx.compose.foundation.layout.fillMaxSize
+import androidx.compose.foundation.layout.fillMaxWidth
 import androidx.compose.foundation.layout.padding
 import androidx.compose.foundation.layout.size
+import androidx.compose.material3.LinearProgressIndicator
 import androidx.compose.material3.MaterialTheme
 import androidx.compose.material3.Text
 import androidx.compose.runtime.Composable
 import androidx.compose.runtime.DisposableEffect
 import androidx.compose.runtime.getValue
 import androidx.compose.runtime.mutableStateOf
+import androidx.compose.runtime.remember
 import androidx.compose.runtime.rememberCoroutineScope
 import androidx.compose.runtime.saveable.rememberSaveable
 import androidx.compose.runtime.setValue
@@ -49,6 +52,7 @@ fun LoadingScreen(safeAreaInsets: EdgeInsets) {
     val lifeCycleOwner = LocalLifecycleOwner.current
 
     var statusText by rememberSaveable { mutableStateOf(viewModel.appStatusReporter.status) }
+    var loadingProgress by remember { mutableStateOf(viewModel.appStatusReporter.progress) }
     val scope = rememberCoroutineScope()
 
     DisposableEffect(lifeCycleOwner) {
@@ -60,6 +64,12 @@ fun LoadingScreen(safeAreaInsets: EdgeInsets) {
             }
 
             override fun celestiaLoadingStateChanged(newState: AppStatusReporter.State) {}
+
+            override fun celestiaLoadingFractionChanged(progress: Float?) {
+                scope.launch {
+                    loadingProgress = progress
+                }
+            }
         }
         viewModel.appStatusReporter.register(observer)
         onDispose {
@@ -84,6 +94,10 @@ fun LoadingScreen(safeAreaInsets: EdgeInsets) {
         Column(horizontalAlignment = Alignment.CenterHorizontally, verticalArrangement = Arrangement.spacedBy(dimensionResource(R.dimen.loading_gap_vertical))) {
             Image(painter = painterResource(space.celestia.celestiaui.R.drawable.loading_icon), contentDescription = null, modifier = Modifier.size(dimensionResource(space.celestia.celestiaui.R.dimen.app_icon_dimension)))
             Text(text = statusText, textAlign = TextAlign.Center, color = MaterialTheme.colorScheme.onBackground, style = MaterialTheme.typography.bodyLarge)
+            val currentProgress = loadingProgress
+            if (currentProgress != null) {
+                LinearProgressIndicator(progress = { currentProgress }, modifier = Modifier.fillMaxWidth())
+            }
         }
     }
 }
\ No newline at end of file
@@ -0,0 +1,72 @@
+// StartupReportFileTest.kt
+//
+// Copyright (C) 2025, Celestia Development Team
+//
+// This program is free software; you can redistribute it and/or
+// modify it under the terms of the GNU General Public License
+// as published by the Free Software Foundation; either version 2
+// of the License, or (at your option) any later version.
+
+package space.celestia.mobilecelestia.celestia
+
+import org.junit.Assert.assertEquals
+import org.junit.Assert.assertNull
+import org.junit.Test
+
+class StartupReportFileTest {
+    // As written by StartupProfiler::writeReport, nlohmann::json sorts the keys
+    private val report = """
+        {
+          "dsoCount": 10937,
+          "phases": [
+            {
+              "bytesRead": 1024,
+              "cpuTime": 0.01,
+              "heapBytesAtEnd": 4194304,
+              "name": "Configuration",
+              "wallTime": 0.02
+            },
+            {
+              "bytesRead": 38797312,
+              "cpuTime": 0.9,
+              "heapBytesAtEnd": 134217728,
+              "name": "stars.dat",
+              "wallTime": 1.25
+            },
+            {
+              "bytesRead": 0,
+              "cpuTime": 0.1,
+              "heapBytesAtEnd": 150994944,
+              "name": "First frame",
+              "wallTime": 0.5
+            }
+          ],
+          "starCount": 118218
+        }
+    """.trimIndent()
+
+    @Test
+    fun decodesReport() {
+        val decoded = StartupReportFile.decode(report)!!
+        assertEquals(118218L, decoded.starCount)
+        assertEquals(10937L, decoded.dsoCount)
+        assertEquals(listOf("Configuration", "stars.dat", "First frame"), decoded.phases.map { it.name })
+        assertEquals(38797312L, decoded.phases[1].bytesRead)
+        assertEquals(134217728L, decoded.phases[1].heapBytesAtEnd)
+        assertEquals(1.77, decoded.totalWallTime, 1e-9)
+    }
+
+    @Test
+    fun ordersSlowestPhases() {
+        val decoded = StartupReportFile.decode(report)!!
+        assertEquals(listOf("stars.dat", "First frame"), decoded.slowestPhases(2).map { it.name })
+        assertEquals("1.770 s to first frame, 118218 stars, 10937 DSOs, slowest: stars.dat 1.250 s, First frame 0.500 s", decoded.summary(2))
+    }
+
+    @Test
+    fun rejectsMalformedReport() {
+        // Left behind if the app is killed while the report is written
+        assertNull(StartupReportFile.decode(report.substring(0, report.length / 2)))
+        assertNull(StartupReportFile.decode(""))
+    }
+}